@@ -20,7 +20,7 @@
 TEMPLATE = app
 TARGET = BigInteger
 QT -= gui core
-CONFIG += release console
+CONFIG += release console c++11 thread
 
 DESTDIR = ../bin
 OBJECTS_DIR = ./obj/
@@ -29,13 +29,20 @@ DEPENDPATH += .
 
 # Input
 HEADERS += \
-../src/Bit.h \
-../src/Bit_impl.hpp \
-../src/Bit_func.hpp \
 ../src/BigInteger.h \
+../src/BigInteger_buffer.hpp \
+../src/BigInteger_parallel.hpp \
+../src/BigInteger_kernel.hpp \
+../src/BigInteger_ntt.hpp \
 ../src/BigInteger_impl.hpp \
-../src/BigInteger_func.hpp
+../src/BigInteger_func.hpp \
+../src/BigInteger_string.hpp \
+../src/BigInteger_bits.hpp \
+../src/BigInteger_mod.hpp \
+../src/BigInteger_gcd.hpp \
+../src/BigInteger_root.hpp \
+../src/BigInteger_comb.hpp \
+../src/BigInteger_expr.hpp
 
 SOURCES += \
-../src/Bit.cpp \
 ../src/main.cpp
@@ -1,276 +1,530 @@
-/*
-Copyright (C) 2014 Ilya Arkhipovsky
-This file is part of BigInteger.
-( Implementation of long arithmetic. The base of the system of numeration is any integer from 2 to 1 << ((sizeof(unsigned long long)<<2)-1) )
-
-This program is free software: you can redistribute it and/or modify
-it under the terms of the GNU General Public License as published by
-the Free Software Foundation, either version 3 of the License, or
-(at your option) any later version.
-
-This program is distributed in the hope that it will be useful,
-but WITHOUT ANY WARRANTY; without even the implied warranty of
-MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-GNU General Public License for more details.
-
-You should have received a copy of the GNU General Public License
-along with this program.  If not, see <http://www.gnu.org/licenses/>.
-
-Contact e-mail <arkhipovsky.ilya@yandex.ru>
-*/
-
-#ifndef BIG_INTEGER_H
-#define BIG_INTEGER_H
-
-#include <vector>
-using std::vector;
-
-#include <cmath>
-#include <utility>
-
-#include "Bit.h"
-
-namespace BigIntegerSpace {
-	template<typename T>
-	struct BitSize {
-		enum {
-			bitsize = (sizeof(T)<<2)-1/*bit count*/
-		};
-	};
-
-	//choose typev for Bit<typev>
-	template<int SWITCHER> 
-	struct TraitsBase {
-		typedef unsigned int typev;
-	};
-	template<> struct TraitsBase<0>{
-		typedef unsigned char typev;
-	};
-	template<> struct TraitsBase<2>{
-		typedef unsigned long typev;
-	};
-	template<> struct TraitsBase<3>{
-		typedef unsigned long long typev;
-	};
-}
-namespace BIS = BigIntegerSpace;
-
-template<unsigned long long BASE = 0> class BigInteger;
-template<unsigned long long BASE> std::ostream& operator<<(std::ostream& out, const BigInteger<BASE>& big);
-template<unsigned long long BASE> const BigInteger<BASE> operator*(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs);
-template<unsigned long long BASE> const BigInteger<BASE> operator/(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs);
-template<unsigned long long BASE> const BigInteger<BASE> operator%(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs);
-template<unsigned long long BASE> std::pair< BigInteger<BASE>, BigInteger<BASE> > divide(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs);
-
-template< unsigned long long BASE>
-class BigInteger {
-//friends
-		friend std::ostream& operator<< <BASE>(std::ostream& out, const BigInteger<BASE>& big);
-		friend const BigInteger<BASE> operator* <BASE>(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs);
-		friend const BigInteger<BASE> operator/ <BASE>(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs);
-		friend const BigInteger<BASE> operator% <BASE>(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs);
-		friend std::pair< BigInteger<BASE>, BigInteger<BASE> > divide<BASE>(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs);
-//enums
-		enum { 
-			SWITCHER = 
-				(BASE < 2) ? 1/*uint*/ : 
-				(BASE <= (1<<(BIS::BitSize< BIS::TraitsBase<0>::typev >::bitsize)) ) ? 0/*uchar*/ : 
-				(BASE <= (1<<(BIS::BitSize< BIS::TraitsBase<1>::typev >::bitsize)) ) ? 1/*uint*/ : 
-				(BASE <= (1<<(BIS::BitSize< BIS::TraitsBase<2>::typev >::bitsize)) ) ? 2/*ulong*/ : 
-				3/*ulonglong*/
-		};
-//types
-	public:
-		typedef typename BIS::TraitsBase<SWITCHER>::typev typev;//Bit<typev>
-		typedef BitSpace::Bit<typev> bit;
-//init
-	public:
-		BigInteger(long long i = 0) : _sign(i>=0) {
-			setBase();
-			resize(1);
-			i = ::llabs(i);
-			convertFromEmb<unsigned long long>(static_cast<unsigned long long>(i));
-		}
-		BigInteger(unsigned long long u, bool sign) : _sign(sign) {
-			setBase();
-			resize(1);
-			convertFromEmb<unsigned long long>(u);
-		}
-		BigInteger(const BigInteger& cpy) {init(cpy);}
-		BigInteger(const BigInteger& cpy, bool) {//invert _sign
-			init(cpy);
-			invertSign();
-		}
-		BigInteger& operator=(const BigInteger& cpy) {
-			if(&cpy != this) init(cpy); 
-			return *this;
-		}
-	private:
-		void init(const BigInteger& cpy) {
-			_a = cpy._a;
-			_base = cpy.base();
-			_sign = cpy.sign();
-			_realSize = cpy.realSize();
-			_capacity = cpy.capacity();
-		}
-		void setBase() {
-			if(BASE < 2 || BASE > 1<<(BIS::BitSize<typev>::bitsize)) _base = 1<<(BIS::BitSize<typev>::bitsize);
-			else _base = BASE;
-		}
-//memory
-	public:
-		int realSize() const;//realSize >= 1, realSize <= capacity()
-		void updRealSize(int shift = 0) const;
-		int capacity() const {return _capacity;}
-		void reserve(int n);
-		void shrink();
-	private:
-		int expand();
-		int increaseSizeRule(int size) {return size<<1;}
-		void resize(int newSize, typev u = 0) {
-			_a.resize(newSize, bit(u));
-			_capacity = _a.size();
-		}
-//info
-	public:
-		typev base() const {return _base;}
-		int bitsize() const {return BIS::BitSize<typev>::bitsize;}
-		bool sign() const {return _sign;}
-		bool isNan() const {return _a[0].isNan();}
-		bool isInf() const {return _a[0].isInf();}
-		bool isReal() const {return _a[0].isReal();}
-		bool isNull() const {return (realSize() == 1) && (_a[0] == 0);}
-//access
-	public:
-		const bit index(int index) const {return _a[index];}
-	private:
-		const bit operator[](int index) const {return _a[index];}
-		bit& operator[] (int index) {return _a[index];}
-//arithmetic
-	public:
-		template<unsigned long long BASE2>
-		BigInteger<BASE>& convert(const BigInteger<BASE2>& cpy) {//b = BASE2, B = BASE, cpy --> *this
-			BigInteger<BASE2> den(BASE);
-			BigInteger<BASE2> zero(0);//+0
-			BigInteger<BASE2> zero2(0,false);//-0
-			BigInteger<BASE2> u(cpy);
-
-			std::pair< BigInteger<BASE2>, BigInteger<BASE2> > par;
-			BigInteger<BASE2>& quotient = par.first;
-			BigInteger<BASE2>& rest = par.second;
-
-			(*this) = 0;
-			_sign = cpy.sign();
-			int index = 0;
-			unsigned long long ull, mul;
-			int rsize;
-			while(true) {
-				par = divide(u, den);
-				_a[index] = 0;
-				mul = 1;
-				rsize = rest.realSize();
-				for(int i = 0; i < rsize; ++i) {
-					ull = rest.index(i).toULL(); 
-					ull *= mul;
-					mul *= rest.base();
-					_a[index] += ull;
-				}
-				if(quotient == zero || quotient == zero2) break;
-				++index;
-				u = quotient;
-				reserve(index+1);
-			}
-			updRealSize();
-			return *this;
-		}
-
-		void setInf() {
-			resize(1);
-			updRealSize();
-			_a[0].setInf();
-		}
-		void setNan() {
-			resize(1);
-			updRealSize();
-			_a[0].setNan();
-			_sign = true;
-		}
-		BigInteger& operator+=(const BigInteger& rhs) {
-			if(sign() ^ rhs.sign()) 
-				return minus(rhs);
-			else 
-				return plus(rhs);
-		}
-		BigInteger& operator-=(const BigInteger& rhs) {
-			if(sign() ^ rhs.sign()) 
-				return plus(rhs);
-			else 
-				return minus(rhs);
-		}
-		//Karatsuba algorithm
-		//AD + BC = (A+B)*(C+D) - AC - BD
-		//(A + B*base^(n/2))*(C + D*base^(n/2)) = AC + BD*base^(n) + (AD + BC)*base^(n/2) = 
-		// = AC + BD*base^n + base^(n/2)*((A+B)*(C+D) - AC - BD)
-		BigInteger& operator*=(const BigInteger& rhs) {
-			(*this) = (*this)*rhs;
-			return *this;
-		}
-		BigInteger& operator/=(const BigInteger& rhs) {
-			(*this) = (*this)/rhs;
-			return *this;
-		}
-		BigInteger& operator%=(const BigInteger& rhs) {
-			(*this) = (*this)%rhs;
-			return *this;
-		}
-		BigInteger& operator<<=(int shift);
-		BigInteger& operator>>=(int shift);
-		const BigInteger operator-() {return BigInteger<BASE>(*this, true);}
-	private:
-		template<typename typeu>
-		void convertFromEmb(typeu u) {
-			if(u >= base()) {
-				unsigned long long tmp,tmp2;
-				int index = 0;
-				for(;; ++index) {
-					reserve(index+1);
-
-					tmp = u / base();
-					tmp2 = u - tmp*base();
-
-					_a[index] = tmp2;
-					if(tmp == 0) break;
-					u = tmp;
-				}
-				updRealSize();
-			}
-			else {
-				_a[0] = u;
-				_realSize = 1;
-			}
-		}
-		BigInteger& plus(const BigInteger& rhs);
-		BigInteger& plus_bit(const BigInteger& rhs);//sizelhs == sizerhs
-		BigInteger& minus(const BigInteger& rhs);
-		BigInteger bisection();
-		void invertSign() {_sign = !sign();}
-		void abs() {_sign = true;}
-//compare
-	public:
-		bool smallerAbs(const BigInteger& rhs) const {return compareAbs(rhs) <  0;}
-		bool equalAbs(const BigInteger& rhs)   const {return compareAbs(rhs) == 0;}
-	private:
-		int compareAbs(const BigInteger& rhs) const;
-//members
-	private:
-		vector<bit> _a;
-		bool _sign;// true-(+), false-(-)
-		typev _base;// _base >= 2 && _base <= BitSize<typev>::base
-		mutable int _realSize;
-		int _capacity;
-};
-
-#include "BigInteger_impl.hpp"
-#include "BigInteger_func.hpp"
-
-#endif
+/*
+Copyright (C) 2014 Ilya Arkhipovsky
+This file is part of BigInteger.
+( Implementation of long arithmetic. The base of the system of numeration is any integer from 2 to 1 << ((sizeof(unsigned long long)<<2)-1) )
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Contact e-mail <arkhipovsky.ilya@yandex.ru>
+*/
+
+#ifndef BIG_INTEGER_H
+#define BIG_INTEGER_H
+
+#include <vector>
+using std::vector;
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace BigIntegerSpace {
+	template<typename T>
+	struct BitSize {
+		enum {
+			bitsize = (sizeof(T)<<2)-1/*bit count*/
+		};
+	};
+
+	//log2(N) if N is a power of two, else 0
+	template<unsigned long long N>
+	struct BinaryDigits {
+		enum {
+			value = ((N & (N-1)) == 0) ? 1 + BinaryDigits<(N>>1)>::value : 0
+		};
+	};
+	template<> struct BinaryDigits<1> {enum {value = 0};};
+	template<> struct BinaryDigits<0> {enum {value = 0};};
+
+	//choose typev for Bit<typev>
+	template<int SWITCHER> 
+	struct TraitsBase {
+		typedef unsigned int typev;
+	};
+	template<> struct TraitsBase<0>{
+		typedef unsigned char typev;
+	};
+	template<> struct TraitsBase<2>{
+		typedef unsigned long typev;
+	};
+	template<> struct TraitsBase<3>{
+		typedef unsigned long long typev;
+	};
+	template<> struct TraitsBase<4>{//machine word, base is 1 << (8*sizeof(typev))
+#ifdef __SIZEOF_INT128__
+		typedef unsigned long long typev;
+#else
+		typedef unsigned int typev;
+#endif
+	};
+
+	//crossover points of operator*, divide() and gcd() in limbs
+	//specialize for a typev to tune it at compile time
+	template<typename T>
+	struct TraitsMul {
+		enum {
+			karatsuba = 96/*schoolbook below*/,
+			toom3 = 256/*Karatsuba below*/,
+			toom4 = 1024/*Toom-3 below*/,
+			ntt = 2048/*Toom-4 below*/,
+			division = 128/*Knuth algorithm D below*/,
+			gcd = 64/*Lehmer below, half-GCD above*/,
+			parallel = 1024/*subproducts go to BIS::ThreadPool above*/
+		};
+	};
+	template<> struct TraitsMul<unsigned char>{//column sums of small limbs rarely fold
+		enum {
+			karatsuba = 128,
+			toom3 = 256,
+			toom4 = 1024,
+			ntt = 2048,
+			division = 128,
+			gcd = 256,
+			parallel = 4096
+		};
+	};
+	template<> struct TraitsMul<unsigned int>{
+		enum {
+			karatsuba = 128,
+			toom3 = 256,
+			toom4 = 1024,
+			ntt = 2048,
+			division = 128,
+			gcd = 64,
+			parallel = 2048
+		};
+	};
+	//crossover points used at runtime, start from TraitsMul
+	//BIS::Threshold<BigInteger<BASE>::typev>::karatsuba = n;
+	template<typename T>
+	struct Threshold {
+		static int karatsuba;
+		static int toom3;
+		static int toom4;
+		static int ntt;
+		static int division;
+		static int gcd;
+		static int parallel;
+	};
+	template<typename T> int Threshold<T>::karatsuba = TraitsMul<T>::karatsuba;
+	template<typename T> int Threshold<T>::toom3 = TraitsMul<T>::toom3;
+	template<typename T> int Threshold<T>::toom4 = TraitsMul<T>::toom4;
+	template<typename T> int Threshold<T>::ntt = TraitsMul<T>::ntt;
+	template<typename T> int Threshold<T>::division = TraitsMul<T>::division;
+	template<typename T> int Threshold<T>::gcd = TraitsMul<T>::gcd;
+	template<typename T> int Threshold<T>::parallel = TraitsMul<T>::parallel;
+
+	//sign and |y| of a built-in integer, |LLONG_MIN| included
+	template<typename Y>
+	bool isNegative(Y y) {return std::is_signed<Y>::value && y < Y(0);}
+	template<typename Y>
+	unsigned long long magnitude(Y y) {return isNegative(y) ? 0ULL - static_cast<unsigned long long>(y) : static_cast<unsigned long long>(y);}
+
+	//limbs kept inside BigInteger before the heap is used, a power of two
+	//specialize for a typev to tune it at compile time
+	template<typename T>
+	struct TraitsBuffer {
+		enum {
+			inlineLimbs = 2*sizeof(unsigned long long)/sizeof(T)/*two machine words*/
+		};
+	};
+}
+namespace BIS = BigIntegerSpace;
+
+#include "BigInteger_buffer.hpp"
+#include "BigInteger_parallel.hpp"
+#include "BigInteger_kernel.hpp"
+#include "BigInteger_ntt.hpp"
+
+template<unsigned long long BASE = 0> class BigInteger;
+template<unsigned long long BASE> class Modulus;
+template<unsigned long long BASE> std::ostream& operator<<(std::ostream& out, const BigInteger<BASE>& big);
+template<unsigned long long BASE> BigInteger<BASE> operator*(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs);
+template<unsigned long long BASE> BigInteger<BASE> operator/(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs);
+template<unsigned long long BASE> BigInteger<BASE> operator%(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs);
+template<unsigned long long BASE> std::pair< BigInteger<BASE>, BigInteger<BASE> > divide(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs);
+template<unsigned long long BASE> BigInteger<BASE> square(const BigInteger<BASE>& big);
+template<unsigned long long BASE> BigInteger<BASE>& addMul(BigInteger<BASE>& acc, const BigInteger<BASE>& a, const BigInteger<BASE>& b);
+template<unsigned long long BASE> BigInteger<BASE>& subMul(BigInteger<BASE>& acc, const BigInteger<BASE>& a, const BigInteger<BASE>& b);
+template<unsigned long long BASE> BigInteger<BASE>& addMulLimb(BigInteger<BASE>& acc, const BigInteger<BASE>& a, unsigned long long m);
+template<unsigned long long BASE> BigInteger<BASE>& addShifted(BigInteger<BASE>& acc, const BigInteger<BASE>& x, int shift);
+template<unsigned long long BASE> BigInteger<BASE>& subShifted(BigInteger<BASE>& acc, const BigInteger<BASE>& x, int shift);
+template<unsigned long long BASE> BigInteger<BASE> powmod(const BigInteger<BASE>& x, const BigInteger<BASE>& exp, const BigInteger<BASE>& mod);
+template<unsigned long long BASE> BigInteger<BASE> powmodConstTime(const BigInteger<BASE>& x, const BigInteger<BASE>& exp, const BigInteger<BASE>& mod);
+template<unsigned long long BASE> BigInteger<BASE> gcd(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs);
+template<unsigned long long BASE> BigInteger<BASE> xgcd(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs, BigInteger<BASE>& x, BigInteger<BASE>& y);
+template<unsigned long long BASE> BigInteger<BASE> modinv(const BigInteger<BASE>& x, const BigInteger<BASE>& mod);
+template<unsigned long long BASE> BigInteger<BASE> iroot(const BigInteger<BASE>& x, int k);
+template<unsigned long long BASE> bool isPerfectSquare(const BigInteger<BASE>& x);
+template<unsigned long long BASE> BigInteger<BASE> product(const vector< BigInteger<BASE> >& values);
+template<unsigned long long BASE> BigInteger<BASE> product(unsigned long long first, unsigned long long last);
+template<unsigned long long BASE> BigInteger<BASE> factorial(int n);
+template<unsigned long long BASE> BigInteger<BASE> binomial(int n, int k);
+
+template< unsigned long long BASE>
+class BigInteger {
+//friends
+		friend class Modulus<BASE>;
+		friend std::ostream& operator<< <BASE>(std::ostream& out, const BigInteger<BASE>& big);
+		friend BigInteger<BASE> operator* <BASE>(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs);
+		friend BigInteger<BASE> operator/ <BASE>(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs);
+		friend BigInteger<BASE> operator% <BASE>(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs);
+		friend std::pair< BigInteger<BASE>, BigInteger<BASE> > divide<BASE>(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs);
+		friend BigInteger<BASE> square<BASE>(const BigInteger<BASE>& big);
+		friend BigInteger<BASE>& addMul<BASE>(BigInteger<BASE>& acc, const BigInteger<BASE>& a, const BigInteger<BASE>& b);
+		friend BigInteger<BASE>& subMul<BASE>(BigInteger<BASE>& acc, const BigInteger<BASE>& a, const BigInteger<BASE>& b);
+		friend BigInteger<BASE>& addMulLimb<BASE>(BigInteger<BASE>& acc, const BigInteger<BASE>& a, unsigned long long m);
+		friend BigInteger<BASE>& addShifted<BASE>(BigInteger<BASE>& acc, const BigInteger<BASE>& x, int shift);
+		friend BigInteger<BASE>& subShifted<BASE>(BigInteger<BASE>& acc, const BigInteger<BASE>& x, int shift);
+		friend BigInteger<BASE> powmod<BASE>(const BigInteger<BASE>& x, const BigInteger<BASE>& exp, const BigInteger<BASE>& mod);
+		friend BigInteger<BASE> powmodConstTime<BASE>(const BigInteger<BASE>& x, const BigInteger<BASE>& exp, const BigInteger<BASE>& mod);
+		friend BigInteger<BASE> gcd<BASE>(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs);
+		friend BigInteger<BASE> xgcd<BASE>(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs, BigInteger<BASE>& x, BigInteger<BASE>& y);
+		friend BigInteger<BASE> modinv<BASE>(const BigInteger<BASE>& x, const BigInteger<BASE>& mod);
+		friend BigInteger<BASE> iroot<BASE>(const BigInteger<BASE>& x, int k);
+		friend bool isPerfectSquare<BASE>(const BigInteger<BASE>& x);
+		friend BigInteger<BASE> product<BASE>(const vector< BigInteger<BASE> >& values);
+		friend BigInteger<BASE> product<BASE>(unsigned long long first, unsigned long long last);
+		friend BigInteger<BASE> factorial<BASE>(int n);
+		friend BigInteger<BASE> binomial<BASE>(int n, int k);
+//enums
+		enum { 
+			SWITCHER = 
+				(BASE < 2) ? 4/*native*/ : 
+				(BASE <= (1ULL<<(BIS::BitSize< BIS::TraitsBase<0>::typev >::bitsize)) ) ? 0/*uchar*/ : 
+				(BASE <= (1ULL<<(BIS::BitSize< BIS::TraitsBase<1>::typev >::bitsize)) ) ? 1/*uint*/ : 
+				(BASE <= (1ULL<<(BIS::BitSize< BIS::TraitsBase<2>::typev >::bitsize)) ) ? 2/*ulong*/ : 
+				3/*ulonglong*/
+		};
+		enum {//_state
+			REAL = 0,
+			INFTY = 1,
+			NANUM = 2
+		};
+//types
+	public:
+		typedef typename BIS::TraitsBase<SWITCHER>::typev typev;//limb
+		static const unsigned long long LIMB = //base of the limb, 0 - all bits of typev
+			(BASE < 2) ? 0 : 
+			(BASE > (1ULL<<(BIS::BitSize<typev>::bitsize))) ? (1ULL<<(BIS::BitSize<typev>::bitsize)) : 
+			BASE;
+		typedef BIS::Limb<typev, LIMB> limb;
+		typedef BIS::Kernel<typev, LIMB> kernel;
+		typedef BIS::Karatsuba<typev, LIMB> karatsuba;
+		typedef BIS::Reciprocal<typev, LIMB> divisor;//invariant limb divisor, 0 < d < base
+		typedef BIS::LimbBuffer<typev, BIS::TraitsBuffer<typev>::inlineLimbs> buffer;
+		enum {
+			NTTDIGITS = (LIMB == 0 && sizeof(typev) > sizeof(unsigned)) ? 2 : 1/*32-bit NTT digits per limb*/,
+			NATIVELIMBS = (LIMB == 0) ? (sizeof(unsigned long long) + sizeof(typev) - 1)/sizeof(typev) : 
+				(LIMB < 16) ? 64 : (LIMB < 65536) ? 16 : 4/*limbs of an unsigned long long*/,
+			BITS = (LIMB == 0) ? static_cast<int>(8*sizeof(typev)) : static_cast<int>(BIS::BinaryDigits<LIMB>::value)/*bits per limb, 0 if the base is not a power of two*/
+		};
+//init
+	public:
+		BigInteger(long long i = 0) : _sign(i>=0), _state(REAL) {
+			resize(1);
+			i = ::llabs(i);
+			convertFromEmb<unsigned long long>(static_cast<unsigned long long>(i));
+		}
+		BigInteger(unsigned long long u, bool sign) : _sign(sign), _state(REAL) {
+			resize(1);
+			convertFromEmb<unsigned long long>(u);
+		}
+		explicit BigInteger(const std::string& str, int radix = 10) : _sign(true), _state(REAL) {//Nan if str is not a number
+			resize(1);
+			convertFromEmb<unsigned long long>(0);
+			const char* first = str.c_str();
+			const char* last = first + str.size();
+			const char* end = fromChars(first, last, radix);
+			if(end == first || end != last) 
+				setNan();
+		}
+		BigInteger(const BigInteger& cpy) {init(cpy);}
+		BigInteger(const BigInteger& cpy, bool) {//invert _sign
+			init(cpy);
+			invertSign();
+		}
+		BigInteger& operator=(const BigInteger& cpy) {
+			if(&cpy != this) init(cpy); 
+			return *this;
+		}
+		BigInteger(BigInteger&& tmp) noexcept : //tmp is left +0
+			_a(std::move(tmp._a)), _sign(tmp._sign), _state(tmp._state), _realSize(tmp._realSize), _capacity(tmp._capacity) {
+			tmp.resize(1);
+			tmp._a[0] = 0;
+			tmp._realSize = 1;
+			tmp._sign = true;
+			tmp._state = REAL;
+		}
+		BigInteger& operator=(BigInteger&& tmp) noexcept {//buffers are swapped, tmp keeps the old value
+			_a.swap(tmp._a);
+			std::swap(_sign, tmp._sign);
+			std::swap(_state, tmp._state);
+			std::swap(_realSize, tmp._realSize);
+			std::swap(_capacity, tmp._capacity);
+			return *this;
+		}
+	private:
+		void init(const BigInteger& cpy) {
+			_a = cpy._a;
+			_sign = cpy.sign();
+			_state = cpy._state;
+			_realSize = cpy.realSize();
+			_capacity = cpy.capacity();
+		}
+//memory
+	public:
+		int realSize() const;//realSize >= 1, realSize <= capacity()
+		void updRealSize(int shift = 0) const;
+		int capacity() const {return _capacity;}
+		void reserve(int n);
+		void shrink();
+	private:
+		int expand();
+		int increaseSizeRule(int size) {return size<<1;}
+		void resize(int newSize, typev u = 0) {
+			_a.resize(newSize, u);
+			_capacity = _a.size();
+		}
+//info
+	public:
+		typev base() const {return static_cast<typev>(LIMB);}//0 - 1 << (8*sizeof(typev))
+		int bitsize() const {return (LIMB == 0) ? static_cast<int>(8*sizeof(typev)) : static_cast<int>(BIS::BitSize<typev>::bitsize);}
+		bool sign() const {return _sign;}
+		bool isNan() const {return _state == NANUM;}
+		bool isInf() const {return _state == INFTY;}
+		bool isReal() const {return _state == REAL;}
+		bool isNull() const {return isReal() && (realSize() == 1) && (_a[0] == 0);}
+//access
+	public:
+		typev index(int index) const {return _a[index];}
+	private:
+		typev operator[](int index) const {return _a[index];}
+		typev& operator[] (int index) {return _a[index];}
+//arithmetic
+	public:
+		template<unsigned long long BASE2>
+		BigInteger<BASE>& convert(const BigInteger<BASE2>& cpy) {//b = BASE2, B = BASE, cpy --> *this
+			if(!cpy.isReal()) {
+				if(cpy.isNan()) setNan();
+				else setInf();
+				_sign = cpy.sign();
+				return *this;
+			}
+			int rsize = cpy.realSize();
+			if(BigInteger<BASE2>::LIMB == LIMB && sizeof(typename BigInteger<BASE2>::typev) == sizeof(typev)) {//same limbs
+				if(static_cast<const void*>(&cpy) == this) 
+					return *this;
+				(*this) = 0;
+				reserve(rsize);
+				for(int index = 0; index < rsize; ++index)
+					_a[index] = static_cast<typev>(cpy.index(index));
+				updRealSize();
+				_sign = cpy.sign();
+				return *this;
+			}
+			//limbs of cpy are joined by halves: hi*b^k + lo, the powers b^(2^j) are kept per (b, B)
+			int levels = 0;
+			while((1 << levels) < rsize) 
+				++levels;
+			bool sign = cpy.sign();
+			(*this) = convertRange(cpy, 0, rsize, convertPowers<BASE2>(levels));
+			_sign = sign;
+			return *this;
+		}
+
+		void setInf() {
+			resize(1);
+			updRealSize();
+			_a[0] = 0;
+			_state = INFTY;
+		}
+		void setNan() {
+			resize(1);
+			updRealSize();
+			_a[0] = 0;
+			_state = NANUM;
+			_sign = true;
+		}
+		BigInteger& operator+=(const BigInteger& rhs) {
+			if(sign() ^ rhs.sign()) 
+				return minus(rhs);
+			else 
+				return plus(rhs);
+		}
+		BigInteger& operator-=(const BigInteger& rhs) {
+			if(sign() ^ rhs.sign()) 
+				return plus(rhs);
+			else 
+				return minus(rhs);
+		}
+		//Karatsuba algorithm
+		//AD + BC = AC + BD - (A-B)*(C-D)
+		//(A + B*base^(n/2))*(C + D*base^(n/2)) = AC + BD*base^(n) + (AD + BC)*base^(n/2) = 
+		// = AC + BD*base^n + base^(n/2)*(AC + BD - (A-B)*(C-D))
+		BigInteger& operator*=(const BigInteger& rhs) {
+			(*this) = (*this)*rhs;
+			return *this;
+		}
+		BigInteger& operator/=(const BigInteger& rhs) {
+			(*this) = (*this)/rhs;
+			return *this;
+		}
+		BigInteger& operator%=(const BigInteger& rhs) {
+			(*this) = (*this)%rhs;
+			return *this;
+		}
+		//built-in integers are split into limbs on the stack, a single limb goes to the limb kernels
+		template<typename Y>
+		typename std::enable_if<std::is_integral<Y>::value, BigInteger&>::type operator+=(Y rhs) {return addNative(BIS::magnitude(rhs), !BIS::isNegative(rhs));}
+		template<typename Y>
+		typename std::enable_if<std::is_integral<Y>::value, BigInteger&>::type operator-=(Y rhs) {return addNative(BIS::magnitude(rhs), BIS::isNegative(rhs));}
+		template<typename Y>
+		typename std::enable_if<std::is_integral<Y>::value, BigInteger&>::type operator*=(Y rhs) {return mulNative(BIS::magnitude(rhs), !BIS::isNegative(rhs));}
+		template<typename Y>
+		typename std::enable_if<std::is_integral<Y>::value, BigInteger&>::type operator/=(Y rhs) {return divNative(BIS::magnitude(rhs), !BIS::isNegative(rhs), false);}
+		template<typename Y>
+		typename std::enable_if<std::is_integral<Y>::value, BigInteger&>::type operator%=(Y rhs) {return divNative(BIS::magnitude(rhs), !BIS::isNegative(rhs), true);}
+		BigInteger& operator<<=(int shift);
+		BigInteger& operator>>=(int shift);
+		typev divLimb(const divisor& d);//|*this| /= d, returns |*this| % d
+		typev modLimb(const divisor& d) const;//|*this| % d
+		BigInteger operator-() const & {return BigInteger<BASE>(*this, true);}
+		BigInteger operator-() && {
+			invertSign();
+			return std::move(*this);
+		}
+	private:
+		template<unsigned long long BASE2>
+		static vector<const BigInteger*> convertPowers(int levels);//b^(2^j) in base B, j < levels, shared by the threads
+		template<unsigned long long BASE2>
+		static BigInteger convertRange(const BigInteger<BASE2>& cpy, int begin, int count, const vector<const BigInteger*>& powers);//limbs [begin, begin+count) of |cpy|
+		template<typename typeu>
+		void convertFromEmb(typeu u) {
+			unsigned long long ull = u;
+			int index = 0;
+			for(;; ++index) {
+				reserve(index+1);
+				_a[index] = limb::split(ull);
+				if(ull == 0) break;
+			}
+			updRealSize();
+		}
+		BigInteger& plus(const BigInteger& rhs);
+		BigInteger& minus(const BigInteger& rhs);
+		BigInteger slice(int begin, int count) const;//|limbs [begin, begin+count)|
+		static void products(BigInteger* res, const BigInteger* u, const BigInteger* v, int count, int size);//res[i] = u[i]*v[i], squares if v == 0
+		static BigInteger toom3(const BigInteger& lhs, const BigInteger& rhs);//|lhs*rhs|, &lhs == &rhs squares
+		static BigInteger toom4(const BigInteger& lhs, const BigInteger& rhs);//|lhs*rhs|, &lhs == &rhs squares
+		static BigInteger ntt(const BigInteger& lhs, const BigInteger& rhs);//|lhs*rhs|, &lhs == &rhs squares
+		static BigInteger toom32(const BigInteger& lhs, const BigInteger& rhs);//|lhs*rhs|, lhs is 5/4 to 2 times longer
+		static BigInteger unbalanced(const BigInteger& lhs, const BigInteger& rhs);//|lhs*rhs|, lhs is at least 2 times longer
+		static void divKnuth(const BigInteger& lhs, const BigInteger& rhs, BigInteger& q, BigInteger& r);//|lhs| = q*|rhs| + r, rhs has 2 limbs at least
+		static void divRecursive(const BigInteger& lhs, const BigInteger& rhs, BigInteger& q, BigInteger& r);//the same, |rhs| is normalized
+		static int nativeLimbs(typev* a, unsigned long long u);//u as limbs, a has NATIVELIMBS, returns the count
+		BigInteger& addNative(unsigned long long u, bool sign);//+= (sign ? u : -u)
+		BigInteger& mulNative(unsigned long long u, bool sign);
+		BigInteger& divNative(unsigned long long u, bool sign, bool remainder);
+		void addSpan(const typev* x, int n, int shift, bool sign);//+-|x|*base^shift, x is not a part of _a
+		static BigInteger& mulAcc(BigInteger& acc, const BigInteger& a, const BigInteger& b, bool add);//acc +-= a*b
+		void invertSign() {_sign = !sign();}
+		void abs() {_sign = true;}
+//string
+	public:
+		std::string toString(int radix = 10) const;//radix = [2; 36], digits 0-9a-z
+		char* toChars(char* first, char* last, int radix = 10) const;//writes [first, result), 0 if the buffer is short
+		const char* fromChars(const char* first, const char* last, int radix = 10);//[-+]digits, Inf, Nan; returns the end of the number, first if there is none
+	private:
+		int charsBound(int radix) const;
+//compare
+	public:
+		bool smallerAbs(const BigInteger& rhs) const {return compareAbs(rhs) <  0;}
+		bool equalAbs(const BigInteger& rhs)   const {return compareAbs(rhs) == 0;}
+		int compare(const BigInteger& rhs) const;//-1, 0, 1 like operator<, ==, >; 2 if one is Nan
+		int compare(unsigned long long u, bool sign) const;//with (sign ? u : -u)
+		template<typename Y>
+		int compare(const Y& rhs) const {return compare(rhs, typename std::is_integral<Y>::type());}
+	private:
+		int compareAbs(const BigInteger& rhs) const;
+		template<typename Y>
+		int compare(const Y& rhs, std::true_type) const {return compare(BIS::magnitude(rhs), !BIS::isNegative(rhs));}
+		template<typename Y>
+		int compare(const Y& rhs, std::false_type) const {return compare(BigInteger(rhs));}
+//modular
+	private:
+		static BigInteger residue(const BigInteger& x, const BigInteger& m);//x mod m in [0, m), m > 0
+		static int windowBits(int bits);
+		//x^exp mod |mod| by Montgomery products when gcd(mod, base) == 1, by divide() otherwise
+		static BigInteger powModular(const BigInteger& x, const BigInteger& exp, const BigInteger& mod, bool constTime);
+//gcd
+	private:
+		struct cofactors;//a = c.a*a0 + c.b*b0, b = c.c*a0 + c.d*b0
+		template<typename T>
+		static void combine(BigInteger& x, BigInteger& y, const T& a, const T& b, const T& c, const T& d);//(x, y) = (a*x + b*y, c*x + d*y)
+		static void combine(BigInteger& x, BigInteger& y, const cofactors& m);
+		static void combine(cofactors& m, const cofactors& l);//m = l*m
+		static void order(BigInteger& a, BigInteger& b, cofactors* m);
+		static unsigned long long leadingBits(const BigInteger& x, int shift, int count);
+		static void lehmerStep(BigInteger& a, BigInteger& b, cofactors* m);
+		static void halfGcd(BigInteger& a, BigInteger& b, cofactors* m);
+		static BigInteger gcdCore(BigInteger& a, BigInteger& b, cofactors* m);
+//roots
+	private:
+		static BigInteger power(const BigInteger& x, int k);
+		static BigInteger rootEstimate(const BigInteger& n, int k);//>= n^(1/k), n > 0
+		static BigInteger rootCore(const BigInteger& n, int k);
+//products
+	private:
+		static BigInteger productTree(const vector<BigInteger>& values, int begin, int end);
+		static BigInteger productPacked(const vector<unsigned long long>& factors);
+		static BigInteger productRange(unsigned long long first, unsigned long long last);
+		static vector<unsigned> primes(unsigned n);
+		static BigInteger oddFactorial(unsigned n, const vector<unsigned>& primes);//n! without its factors 2
+//bits
+	public:
+		//negative numbers are two's complement with infinitely many leading ones,
+		//a base that is not a power of two goes through BigInteger<0>
+		BigInteger& shiftBits(int shift);//*this *= 2^shift, shift < 0: floor(*this / 2^-shift)
+		BigInteger& operator&=(const BigInteger& rhs) {return (*this) = bitwise(*this, rhs, '&');}
+		BigInteger& operator|=(const BigInteger& rhs) {return (*this) = bitwise(*this, rhs, '|');}
+		BigInteger& operator^=(const BigInteger& rhs) {return (*this) = bitwise(*this, rhs, '^');}
+		BigInteger operator~() const {return std::move(BigInteger(*this, true) -= 1);}//-x - 1
+		bool testBit(int index) const;
+		int bitLength() const;//of |*this|, 0 for 0
+		int popcount() const;//of |*this|
+	private:
+		static BigInteger bitwise(const BigInteger& lhs, const BigInteger& rhs, char op);
+		static BigInteger powerOfTwo(int k);
+//members
+	private:
+		buffer _a;//packed limbs, sign is kept in _sign only
+		bool _sign;// true-(+), false-(-)
+		unsigned char _state;// REAL, INFTY, NANUM
+		mutable int _realSize;
+		int _capacity;
+};
+
+#include "BigInteger_impl.hpp"
+#include "BigInteger_func.hpp"
+#include "BigInteger_string.hpp"
+#include "BigInteger_bits.hpp"
+#include "BigInteger_mod.hpp"
+#include "BigInteger_gcd.hpp"
+#include "BigInteger_root.hpp"
+#include "BigInteger_comb.hpp"
+
+#endif
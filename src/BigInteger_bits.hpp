@@ -0,0 +1,253 @@
+/*
+Copyright (C) 2014 Ilya Arkhipovsky
+This file is part of BigInteger.
+( Implementation of long arithmetic. The base of the system of numeration is any integer from 2 to 1 << ((sizeof(unsigned long long)<<2)-1) )
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Contact e-mail <arkhipovsky.ilya@yandex.ru>
+*/
+
+#ifndef BIG_INTEGER_BITS_HPP
+#define BIG_INTEGER_BITS_HPP
+
+namespace BigIntegerSpace {
+	inline int popcount(unsigned long long u) {
+#ifdef __GNUC__
+		return __builtin_popcountll(u);
+#else
+		int count = 0;
+		for(; u != 0; u &= u-1) 
+			++count;
+		return count;
+#endif
+	}
+	inline int bitLength(unsigned long long u) {
+		int length = 0;
+		for(; u != 0; u >>= 1) 
+			++length;
+		return length;
+	}
+}
+
+//bits
+template<unsigned long long BASE>
+BigInteger<BASE> BigInteger<BASE>::powerOfTwo(int k) {//2^k by squaring
+	BigInteger res = 1;
+	for(int bit = BIS::bitLength(k) - 1; bit >= 0; --bit) {
+		res = square(res);
+		if((k >> bit) & 1) 
+			res *= 2;
+	}
+	return res;
+}
+template<unsigned long long BASE>
+BigInteger<BASE>& BigInteger<BASE>::shiftBits(int shift) {
+	if(!isReal() || isNull() || shift == 0) 
+		return *this;
+	if(BITS == 0) {//multiply or floor-divide by 2^|shift|
+		if(shift > 0) 
+			return (*this) *= powerOfTwo(shift);
+		bool negative = !sign();
+		std::pair<BigInteger, BigInteger> qr = divide(*this, powerOfTwo(-shift));
+		(*this) = std::move(qr.first);
+		if(negative && !qr.second.isNull()) 
+			(*this) -= 1;
+		if(isNull()) 
+			_sign = true;
+		return *this;
+	}
+	const int bits = (BITS > 0) ? static_cast<int>(BITS) : 1;
+	const typev mask = (LIMB == 0) ? static_cast<typev>(~static_cast<typev>(0)) : static_cast<typev>(LIMB-1);
+	int rsize = realSize();
+	if(shift > 0) {
+		int q = shift / bits;
+		int r = shift % bits;
+		if(r == 0) 
+			return (*this) <<= q;
+		reserve(rsize + q + 1);
+		for(int index = rsize; index >= 0; --index) {
+			typev hi = (index < rsize) ? static_cast<typev>((_a[index] << r) & mask) : 0;
+			typev lo = (index > 0) ? static_cast<typev>(_a[index-1] >> (bits - r)) : 0;
+			_a[index+q] = hi | lo;
+		}
+		for(int index = 0; index < q; ++index) 
+			_a[index] = 0;
+		updRealSize();
+		return *this;
+	}
+	shift = -shift;
+	int q = shift / bits;
+	int r = shift % bits;
+	bool lost = false;//bits shifted out of a negative number round it down
+	for(int index = 0; index < q && index < rsize && !lost; ++index) 
+		lost = (_a[index] != 0);
+	if(q < rsize && r != 0) 
+		lost = lost || (_a[q] & ((static_cast<typev>(1) << r) - 1)) != 0;
+	bool negative = !sign();
+	if(q >= rsize) {
+		(*this) = 0;
+	}
+	else if(r == 0) {
+		(*this) >>= q;
+	}
+	else {
+		for(int index = 0; index < rsize - q; ++index) {
+			typev lo = static_cast<typev>(_a[index+q] >> r);
+			typev hi = (index+q+1 < rsize) ? static_cast<typev>((_a[index+q+1] << (bits - r)) & mask) : 0;
+			_a[index] = lo | hi;
+		}
+		for(int index = rsize - q; index < rsize; ++index) 
+			_a[index] = 0;
+		updRealSize();
+		shrink();
+	}
+	if(negative && lost) {
+		_sign = false;
+		addNative(1, false);
+	}
+	if(isNull()) 
+		_sign = true;
+	return *this;
+}
+template<unsigned long long BASE>
+BigInteger<BASE> BigInteger<BASE>::bitwise(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs, char op) {
+	BigInteger res;
+	if(!lhs.isReal() || !rhs.isReal()) {
+		res.setNan();
+		return res;
+	}
+	if(BITS == 0) {
+		BigInteger<0> l, r;
+		l.convert(lhs);
+		r.convert(rhs);
+		res.convert((op == '&') ? (l &= r) : (op == '|') ? (l |= r) : (l ^= r));
+		return res;
+	}
+	const typev mask = (LIMB == 0) ? static_cast<typev>(~static_cast<typev>(0)) : static_cast<typev>(LIMB-1);
+	bool ln = !lhs.sign() && !lhs.isNull();
+	bool rn = !rhs.sign() && !rhs.isNull();
+	bool neg = (op == '&') ? (ln && rn) : (op == '|') ? (ln || rn) : (ln != rn);
+	int nl = lhs.realSize();
+	int nr = rhs.realSize();
+	int n = ((nl > nr) ? nl : nr) + 1;
+	res.reserve(n);
+	typev cl = 1, cr = 1, cres = 1;//-x = ~x + 1
+	for(int index = 0; index < n; ++index) {
+		typev x = (index < nl) ? lhs._a[index] : 0;
+		typev y = (index < nr) ? rhs._a[index] : 0;
+		if(ln) {
+			typev t = static_cast<typev>((static_cast<typev>(~x) & mask) + cl);
+			cl = cl && x == 0;
+			x = static_cast<typev>(t & mask);
+		}
+		if(rn) {
+			typev t = static_cast<typev>((static_cast<typev>(~y) & mask) + cr);
+			cr = cr && y == 0;
+			y = static_cast<typev>(t & mask);
+		}
+		typev z = (op == '&') ? (x & y) : (op == '|') ? (x | y) : (x ^ y);
+		if(neg) {
+			typev t = static_cast<typev>((static_cast<typev>(~z) & mask) + cres);
+			cres = cres && z == 0;
+			z = static_cast<typev>(t & mask);
+		}
+		res._a[index] = z;
+	}
+	res.updRealSize();
+	res._sign = !neg || res.isNull();
+	return res;
+}
+template<unsigned long long BASE>
+bool BigInteger<BASE>::testBit(int index) const {
+	if(!isReal() || isNull() || index < 0) 
+		return false;
+	if(BITS == 0) {
+		BigInteger<0> tmp;
+		tmp.convert(*this);
+		return tmp.testBit(index);
+	}
+	const int bits = (BITS > 0) ? static_cast<int>(BITS) : 1;
+	int rsize = realSize();
+	int limb = index / bits;
+	bool bit = (limb < rsize) && ((_a[limb] >> (index % bits)) & 1);
+	if(sign()) 
+		return bit;
+	//-x = ~(x-1): bits below the lowest set bit of x stay 0, the lowest set bit stays 1, the rest are inverted
+	int lowest = 0;
+	while(_a[lowest/bits] == 0) 
+		lowest += bits;
+	while(((_a[lowest/bits] >> (lowest % bits)) & 1) == 0) 
+		++lowest;
+	return (index <= lowest) ? bit : !bit;
+}
+template<unsigned long long BASE>
+int BigInteger<BASE>::bitLength() const {
+	if(!isReal() || isNull()) 
+		return 0;
+	if(BITS == 0) {
+		BigInteger<0> tmp;
+		tmp.convert(*this);
+		return tmp.bitLength();
+	}
+	int rsize = realSize();
+	return (rsize-1)*BITS + BIS::bitLength(_a[rsize-1]);
+}
+template<unsigned long long BASE>
+int BigInteger<BASE>::popcount() const {
+	if(!isReal()) 
+		return 0;
+	if(BITS == 0) {
+		BigInteger<0> tmp;
+		tmp.convert(*this);
+		return tmp.popcount();
+	}
+	int count = 0;
+	int rsize = realSize();
+	for(int index = 0; index < rsize; ++index) 
+		count += BIS::popcount(_a[index]);
+	return count;
+}
+
+template<unsigned long long BASE>
+BigInteger<BASE> operator&(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs) {return std::move(BigInteger<BASE>(lhs) &= rhs);}
+template<unsigned long long BASE>
+BigInteger<BASE> operator|(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs) {return std::move(BigInteger<BASE>(lhs) |= rhs);}
+template<unsigned long long BASE>
+BigInteger<BASE> operator^(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs) {return std::move(BigInteger<BASE>(lhs) ^= rhs);}
+namespace BigIntegerSpace {
+	//a built-in integer as BigInteger, unsigned ones >= 2^63 included; other types by the constructor
+	template<unsigned long long BASE, typename Y>
+	BigInteger<BASE> scalar(const Y& y, std::true_type) {return BigInteger<BASE>(magnitude(y), !isNegative(y));}
+	template<unsigned long long BASE, typename Y>
+	BigInteger<BASE> scalar(const Y& y, std::false_type) {return BigInteger<BASE>(y);}
+	template<unsigned long long BASE, typename Y>
+	BigInteger<BASE> scalar(const Y& y) {return scalar<BASE>(y, typename std::is_integral<Y>::type());}
+}
+template<unsigned long long BASE, typename X>
+BigInteger<BASE> operator&(const X& lhs, const BigInteger<BASE>& rhs) {return std::move(BIS::scalar<BASE>(lhs) &= rhs);}
+template<unsigned long long BASE, typename X>
+BigInteger<BASE> operator|(const X& lhs, const BigInteger<BASE>& rhs) {return std::move(BIS::scalar<BASE>(lhs) |= rhs);}
+template<unsigned long long BASE, typename X>
+BigInteger<BASE> operator^(const X& lhs, const BigInteger<BASE>& rhs) {return std::move(BIS::scalar<BASE>(lhs) ^= rhs);}
+template<unsigned long long BASE, typename Y>
+BigInteger<BASE> operator&(const BigInteger<BASE>& lhs, const Y& rhs) {return std::move(BigInteger<BASE>(lhs) &= BIS::scalar<BASE>(rhs));}
+template<unsigned long long BASE, typename Y>
+BigInteger<BASE> operator|(const BigInteger<BASE>& lhs, const Y& rhs) {return std::move(BigInteger<BASE>(lhs) |= BIS::scalar<BASE>(rhs));}
+template<unsigned long long BASE, typename Y>
+BigInteger<BASE> operator^(const BigInteger<BASE>& lhs, const Y& rhs) {return std::move(BigInteger<BASE>(lhs) ^= BIS::scalar<BASE>(rhs));}
+template<unsigned long long BASE>
+BigInteger<BASE> shiftBits(const BigInteger<BASE>& x, int shift) {return std::move(BigInteger<BASE>(x).shiftBits(shift));}
+
+#endif
@@ -0,0 +1,249 @@
+/*
+Copyright (C) 2014 Ilya Arkhipovsky
+This file is part of BigInteger.
+( Implementation of long arithmetic. The base of the system of numeration is any integer from 2 to 1 << ((sizeof(unsigned long long)<<2)-1) )
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Contact e-mail <arkhipovsky.ilya@yandex.ru>
+*/
+
+#ifndef BIG_INTEGER_BUFFER_HPP
+#define BIG_INTEGER_BUFFER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace BigIntegerSpace {
+	//scoped arena: heap limbs allocated on this thread while a region is open are cut from its chunks,
+	//so the temporaries of a whole computation go back in one shot when it closes
+	//the last block cut is given back at once (temporaries of Karatsuba and Toom are freed in reverse order),
+	//a chunk is freed when the region is closed and its last block is released, values may outlive the region
+	//{BIS::ArenaRegion region; x = f(a, b);}
+	class ArenaRegion {
+	public:
+		explicit ArenaRegion(std::size_t chunkSize = 1<<16) : _prev(current()), _chunk(0), _chunkSize(chunkSize) {current() = this;}
+		~ArenaRegion() {
+			current() = _prev;
+			if(_chunk) 
+				release(_chunk);
+		}
+		ArenaRegion(const ArenaRegion&) = delete;
+		ArenaRegion& operator=(const ArenaRegion&) = delete;
+
+		static void* allocate(std::size_t bytes) {//global heap outside of regions
+			ArenaRegion* region = current();
+			Header* block;
+			if(region) {
+				block = region->cut(bytes);
+			}
+			else {
+				block = static_cast<Header*>(::operator new(sizeof(Header) + bytes));
+				block->chunk = 0;
+			}
+			return block + 1;
+		}
+		static void free(void* p) {
+			Header* block = static_cast<Header*>(p) - 1;
+			Chunk* chunk = block->chunk;
+			if(chunk == 0) {
+				::operator delete(block);
+				return;
+			}
+			ArenaRegion* region = current();
+			if(region && region->_chunk == chunk && reinterpret_cast<char*>(block) + block->bytes == chunk->top) 
+				chunk->top = reinterpret_cast<char*>(block);
+			release(chunk);
+		}
+	private:
+		struct Chunk {
+			std::atomic<int> live;//blocks + 1 while it is the current chunk of a region
+			char* top;
+			char* end;
+		};
+		struct Header {//precedes every block
+			Chunk* chunk;//0 - global heap
+			std::size_t bytes;//with the header
+		};
+
+		static ArenaRegion*& current() {
+			static thread_local ArenaRegion* region = 0;
+			return region;
+		}
+		struct Spare {//the last emptied chunk of the thread, the next region starts in warm memory
+			char* raw;
+			std::size_t size;
+			~Spare() {
+				if(raw) 
+					::operator delete(raw);
+			}
+		};
+		static Spare& spare() {
+			static thread_local Spare cache = {0, 0};
+			return cache;
+		}
+		static Chunk* newChunk(std::size_t size, int live) {
+			std::size_t head = round(sizeof(Chunk));
+			Spare& cached = spare();
+			char* raw;
+			if(cached.raw && cached.size >= head + size) {
+				raw = cached.raw;
+				size = cached.size - head;
+				cached.raw = 0;
+			}
+			else {
+				raw = static_cast<char*>(::operator new(head + size));
+			}
+			Chunk* chunk = new(raw) Chunk;
+			chunk->live = live;
+			chunk->top = raw + head;
+			chunk->end = raw + head + size;
+			return chunk;
+		}
+		static void release(Chunk* chunk) {
+			if(--chunk->live == 0) {
+				char* raw = reinterpret_cast<char*>(chunk);
+				std::size_t size = chunk->end - raw;
+				chunk->~Chunk();
+				Spare& cached = spare();
+				if(cached.raw == 0) {
+					cached.raw = raw;
+					cached.size = size;
+				}
+				else {
+					::operator delete(raw);
+				}
+			}
+		}
+		static std::size_t round(std::size_t bytes) {return (bytes + sizeof(Header) - 1)/sizeof(Header)*sizeof(Header);}
+
+		Header* cut(std::size_t bytes) {
+			std::size_t need = sizeof(Header) + round(bytes);
+			Chunk* chunk;
+			if(4*need > _chunkSize) {//own chunk, the current one keeps its room
+				chunk = newChunk(need, 0);
+			}
+			else {
+				if(_chunk == 0 || _chunk->top + need > _chunk->end) {
+					if(_chunk) 
+						release(_chunk);
+					_chunk = newChunk(_chunkSize, 1);
+				}
+				chunk = _chunk;
+			}
+			Header* block = reinterpret_cast<Header*>(chunk->top);
+			chunk->top += need;
+			++chunk->live;
+			block->chunk = chunk;
+			block->bytes = need;
+			return block;
+		}
+
+		ArenaRegion* _prev;
+		Chunk* _chunk;
+		std::size_t _chunkSize;
+	};
+
+	//limb storage of BigInteger: up to N limbs are kept inline, larger sizes go to the heap or the open ArenaRegion
+	//resize() fills the new limbs with u like std::vector, shrinking keeps the heap block
+	template<typename T, int N>
+	class LimbBuffer {
+	public:
+		LimbBuffer() : _p(_inline), _size(0), _capacity(N) {}
+		LimbBuffer(const LimbBuffer& cpy) : _p(_inline), _size(0), _capacity(N) {assign(cpy);}
+		LimbBuffer(LimbBuffer&& tmp) noexcept : _p(_inline), _size(0), _capacity(N) {steal(tmp);}
+		~LimbBuffer() {release();}
+		LimbBuffer& operator=(const LimbBuffer& cpy) {
+			if(&cpy != this) assign(cpy);
+			return *this;
+		}
+		LimbBuffer& operator=(LimbBuffer&& tmp) noexcept {//tmp is left empty
+			if(&tmp != this) {
+				release();
+				_p = _inline;
+				_capacity = N;
+				steal(tmp);
+			}
+			return *this;
+		}
+
+		int size() const {return _size;}
+		bool isInline() const {return _p == _inline;}
+		const T& operator[](int index) const {return _p[index];}
+		T& operator[](int index) {return _p[index];}
+
+		void resize(int n, T u = 0) {
+			if(n > _capacity) {
+				T* p = static_cast<T*>(ArenaRegion::allocate(n*sizeof(T)));
+				for(int index = 0; index < _size; ++index) 
+					p[index] = _p[index];
+				release();
+				_p = p;
+				_capacity = n;
+			}
+			for(int index = _size; index < n; ++index) 
+				_p[index] = u;
+			_size = n;
+		}
+		void swap(LimbBuffer& other) {
+			if(!isInline() && !other.isInline()) {//heap blocks change hands
+				std::swap(_p, other._p);
+				std::swap(_size, other._size);
+				std::swap(_capacity, other._capacity);
+				return;
+			}
+			LimbBuffer tmp(std::move(other));
+			other = std::move(*this);
+			*this = std::move(tmp);
+		}
+	private:
+		void release() {
+			if(!isInline()) 
+				ArenaRegion::free(_p);
+		}
+		void assign(const LimbBuffer& cpy) {
+			if(cpy._size > _capacity) {
+				release();
+				_p = static_cast<T*>(ArenaRegion::allocate(cpy._size*sizeof(T)));
+				_capacity = cpy._size;
+			}
+			for(int index = 0; index < cpy._size; ++index) 
+				_p[index] = cpy._p[index];
+			_size = cpy._size;
+		}
+		void steal(LimbBuffer& tmp) {//*this is inline and empty
+			if(tmp.isInline()) {
+				for(int index = 0; index < tmp._size; ++index) 
+					_inline[index] = tmp._inline[index];
+			}
+			else {
+				_p = tmp._p;
+				_capacity = tmp._capacity;
+				tmp._p = tmp._inline;
+				tmp._capacity = N;
+			}
+			_size = tmp._size;
+			tmp._size = 0;
+		}
+
+		T* _p;//_inline or a heap block of _capacity limbs
+		int _size;
+		int _capacity;
+		T _inline[N];
+	};
+}
+
+#endif
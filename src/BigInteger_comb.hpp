@@ -0,0 +1,161 @@
+/*
+Copyright (C) 2014 Ilya Arkhipovsky
+This file is part of BigInteger.
+( Implementation of long arithmetic. The base of the system of numeration is any integer from 2 to 1 << ((sizeof(unsigned long long)<<2)-1) )
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Contact e-mail <arkhipovsky.ilya@yandex.ru>
+*/
+
+#ifndef BIG_INTEGER_COMB_HPP
+#define BIG_INTEGER_COMB_HPP
+
+//products
+template<unsigned long long BASE>
+BigInteger<BASE> BigInteger<BASE>::productTree(const vector< BigInteger<BASE> >& values, int begin, int end) {//values[begin]*..*values[end-1]
+	if(end - begin == 1) 
+		return values[begin];
+	int mid = begin + (end - begin)/2;
+	return productTree(values, begin, mid)*productTree(values, mid, end);
+}
+template<unsigned long long BASE>
+BigInteger<BASE> BigInteger<BASE>::productPacked(const vector<unsigned long long>& factors) {//factors > 0 are packed into words first
+	vector<BigInteger> words;
+	unsigned long long acc = 1;
+	for(size_t index = 0; index < factors.size(); ++index) {
+		if(acc > ~0ULL / factors[index]) {
+			words.push_back(BigInteger(acc, true));
+			acc = 1;
+		}
+		acc *= factors[index];
+	}
+	words.push_back(BigInteger(acc, true));
+	return productTree(words, 0, static_cast<int>(words.size()));
+}
+template<unsigned long long BASE>
+BigInteger<BASE> BigInteger<BASE>::productRange(unsigned long long first, unsigned long long last) {//first*..*last, first <= last
+	if(last - first < 8) {
+		BigInteger res(first, true);
+		for(unsigned long long value = first+1; value <= last && value > first; ++value) 
+			res *= value;
+		return res;
+	}
+	unsigned long long mid = first + (last - first)/2;
+	return productRange(first, mid)*productRange(mid+1, last);
+}
+template<unsigned long long BASE>
+vector<unsigned> BigInteger<BASE>::primes(unsigned n) {//up to n, sieve of odd numbers
+	vector<unsigned> res;
+	if(n < 2) 
+		return res;
+	res.push_back(2);
+	vector<bool> composite(n/2 + 1, false);//2*i + 1
+	for(unsigned long long i = 1; 2*i + 1 <= n; ++i) {
+		if(composite[i]) 
+			continue;
+		unsigned long long p = 2*i + 1;
+		res.push_back(static_cast<unsigned>(p));
+		for(unsigned long long j = p*p; j <= n; j += 2*p) 
+			composite[j/2] = true;
+	}
+	return res;
+}
+//n!/2^v = oddFactorial(n/2)^2 * swing(n), swing(n) = n!/(n/2)!^2 = prod p^e,
+//e = sum of (n/p^i) mod 2 (prime swing)
+template<unsigned long long BASE>
+BigInteger<BASE> BigInteger<BASE>::oddFactorial(unsigned n, const vector<unsigned>& primes) {
+	if(n < 3) 
+		return BigInteger(1);
+	BigInteger res = square(oddFactorial(n/2, primes));
+	vector<unsigned long long> factors;
+	for(size_t index = 1; index < primes.size() && primes[index] <= n; ++index) {
+		unsigned long long p = primes[index];
+		if(p > n/2) 
+			factors.push_back(p);
+		else if(p > n/3) 
+			continue;
+		else if(p*p > n) {
+			if((n/p) & 1) 
+				factors.push_back(p);
+		}
+		else {
+			unsigned long long q = n, f = 1;
+			while((q /= p) > 0) 
+				if(q & 1) 
+					f *= p;
+			if(f > 1) 
+				factors.push_back(f);
+		}
+	}
+	return res *= productPacked(factors);
+}
+
+template<unsigned long long BASE>
+BigInteger<BASE> product(const vector< BigInteger<BASE> >& values) {//balanced product tree, 1 for no values
+	if(values.empty()) 
+		return BigInteger<BASE>(1);
+	return BigInteger<BASE>::productTree(values, 0, static_cast<int>(values.size()));
+}
+template<unsigned long long BASE>
+BigInteger<BASE> product(unsigned long long first, unsigned long long last) {//first*(first+1)*..*last, 1 if first > last
+	if(first > last) 
+		return BigInteger<BASE>(1);
+	return BigInteger<BASE>::productRange(first, last);
+}
+template<unsigned long long BASE>
+BigInteger<BASE> factorial(int n) {//Nan if n < 0
+	BigInteger<BASE> res;
+	if(n < 0) {
+		res.setNan();
+		return res;
+	}
+	unsigned u = static_cast<unsigned>(n);
+	res = BigInteger<BASE>::oddFactorial(u, BigInteger<BASE>::primes(u));
+	int v = 0;//2^v divides n!, v = n - popcount(n)
+	for(unsigned q = u/2; q > 0; q /= 2) 
+		v += static_cast<int>(q);
+	return std::move(res.shiftBits(v));
+}
+//the exponents of the primes are counted by Legendre's formula, p^e <= n;
+//a short k is the product n-k+1..n divided by k!
+template<unsigned long long BASE>
+BigInteger<BASE> binomial(int n, int k) {//0 for k < 0 or k > n, Nan if n < 0
+	BigInteger<BASE> res;
+	if(n < 0) {
+		res.setNan();
+		return res;
+	}
+	if(k < 0 || k > n) 
+		return BigInteger<BASE>(0);
+	if(k > n - k) 
+		k = n - k;
+	if(k == 0) 
+		return BigInteger<BASE>(1);
+	if(k < n/64) 
+		return product<BASE>(n-k+1, n) / factorial<BASE>(k);
+	vector<unsigned> primes = BigInteger<BASE>::primes(static_cast<unsigned>(n));
+	vector<unsigned long long> factors;
+	for(size_t index = 0; index < primes.size(); ++index) {
+		unsigned long long p = primes[index], f = 1;
+		for(unsigned long long q = p; q <= static_cast<unsigned long long>(n); q *= p) 
+			if(n/q - k/q - (n-k)/q > 0) 
+				f *= p;
+		if(f > 1) 
+			factors.push_back(f);
+	}
+	return BigInteger<BASE>::productPacked(factors);
+}
+
+#endif
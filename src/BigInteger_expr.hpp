@@ -0,0 +1,127 @@
+/*
+Copyright (C) 2014 Ilya Arkhipovsky
+This file is part of BigInteger.
+( Implementation of long arithmetic. The base of the system of numeration is any integer from 2 to 1 << ((sizeof(unsigned long long)<<2)-1) )
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Contact e-mail <arkhipovsky.ilya@yandex.ru>
+*/
+
+#ifndef BIG_INTEGER_EXPR_HPP
+#define BIG_INTEGER_EXPR_HPP
+
+#include "BigInteger.h"
+
+//opt-in expression templates:
+//evaluate(d, lazy(a) + lazy(b)*lazy(c) - (lazy(x) << k)) is a signed sum of terms x*base^k and a*b*base^k,
+//every term goes into d by addShifted/addMul without a temporary for the whole expression
+namespace BigIntegerSpace {
+	template<class E>
+	struct Expr {
+		const E& self() const {return static_cast<const E&>(*this);}
+	};
+
+	//x*base^shift
+	template<unsigned long long BASE>
+	struct Term : Expr< Term<BASE> > {
+		Term(const BigInteger<BASE>& value, int k = 0) : x(value), shift(k) {}
+
+		void apply(BigInteger<BASE>& acc, bool negate) const {
+			if(negate) subShifted(acc, x, shift);
+			else addShifted(acc, x, shift);
+		}
+		bool uses(const void* p) const {return p == &x;}
+
+		const BigInteger<BASE>& x;
+		int shift;
+	};
+
+	//a*b*base^shift
+	template<unsigned long long BASE>
+	struct Product : Expr< Product<BASE> > {
+		Product(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs, int k = 0) : a(lhs), b(rhs), shift(k) {}
+
+		void apply(BigInteger<BASE>& acc, bool negate) const {
+			if(shift == 0) {
+				if(negate) subMul(acc, a, b);
+				else addMul(acc, a, b);
+				return;
+			}
+			BigInteger<BASE> p = a*b;
+			if(negate) subShifted(acc, p, shift);
+			else addShifted(acc, p, shift);
+		}
+		bool uses(const void* p) const {return p == &a || p == &b;}
+
+		const BigInteger<BASE>& a;
+		const BigInteger<BASE>& b;
+		int shift;
+	};
+
+	//l + r, NEG: l - r
+	template<class L, class R, bool NEG>
+	struct Sum : Expr< Sum<L, R, NEG> > {
+		Sum(const L& lhs, const R& rhs) : l(lhs), r(rhs) {}
+
+		template<unsigned long long BASE>
+		void apply(BigInteger<BASE>& acc, bool negate) const {
+			l.apply(acc, negate);
+			r.apply(acc, negate != NEG);
+		}
+		bool uses(const void* p) const {return l.uses(p) || r.uses(p);}
+
+		L l;
+		R r;
+	};
+
+	template<class L, class R>
+	Sum<L, R, false> operator+(const Expr<L>& l, const Expr<R>& r) {return Sum<L, R, false>(l.self(), r.self());}
+	template<class L, class R>
+	Sum<L, R, true> operator-(const Expr<L>& l, const Expr<R>& r) {return Sum<L, R, true>(l.self(), r.self());}
+	template<unsigned long long BASE>
+	Product<BASE> operator*(const Term<BASE>& l, const Term<BASE>& r) {return Product<BASE>(l.x, r.x, l.shift + r.shift);}
+	template<unsigned long long BASE>
+	Term<BASE> operator<<(const Term<BASE>& t, int shift) {return Term<BASE>(t.x, t.shift + shift);}
+	template<unsigned long long BASE>
+	Product<BASE> operator<<(const Product<BASE>& t, int shift) {return Product<BASE>(t.a, t.b, t.shift + shift);}
+}
+
+template<unsigned long long BASE>
+BIS::Term<BASE> lazy(const BigInteger<BASE>& x) {return BIS::Term<BASE>(x);}
+//dest = e, an expression that reads dest is summed into a temporary first
+template<unsigned long long BASE, class E>
+BigInteger<BASE>& evaluate(BigInteger<BASE>& dest, const BIS::Expr<E>& e) {
+	if(e.self().uses(&dest)) {
+		BigInteger<BASE> tmp;
+		e.self().apply(tmp, false);
+		return dest = std::move(tmp);
+	}
+	dest = 0;
+	e.self().apply(dest, false);
+	return dest;
+}
+//dest += e
+template<unsigned long long BASE, class E>
+BigInteger<BASE>& accumulate(BigInteger<BASE>& dest, const BIS::Expr<E>& e) {
+	if(e.self().uses(&dest)) {
+		BigInteger<BASE> tmp;
+		e.self().apply(tmp, false);
+		return dest += tmp;
+	}
+	e.self().apply(dest, false);
+	return dest;
+}
+
+#endif
@@ -34,13 +34,15 @@ std::ostream& operator<<(std::ostream& out, const BigInteger<BASE>& big) {
 		out<<"Inf";
 	}
 	else {
-		if(big.base() > 10 && big.base() != 16) out<<"|";
+		bool separator = (big.base() > 10 || big.base() == 0) && big.base() != 16;
+		if(separator) out<<"|";
 		for(int index = big.realSize()-1; index >= 0; --index) {
+			unsigned long long digit = big[index];
 			if(big.base() == 16) 
-				out<<std::hex<<big[index];
+				out<<std::hex<<digit<<std::dec;
 			else 
-				out<<big[index];
-			if(big.base() > 10 && big.base() != 16) out<<"|";
+				out<<digit;
+			if(separator) out<<"|";
 		}
 	}
 	return out;
@@ -48,12 +50,24 @@ std::ostream& operator<<(std::ostream& out, const BigInteger<BASE>& big) {
 
 //arithmetic
 template<unsigned long long BASE>
-const BigInteger<BASE> operator+(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs) {return BigInteger<BASE>(lhs)+=rhs;}
+BigInteger<BASE> operator+(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs) {return std::move(BigInteger<BASE>(lhs) += rhs);}
 template<unsigned long long BASE>
-const BigInteger<BASE> operator-(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs) {return BigInteger<BASE>(lhs)-=rhs;}
+BigInteger<BASE> operator-(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs) {return std::move(BigInteger<BASE>(lhs) -= rhs);}
+//rvalue operands lend their limbs to the result
+template<unsigned long long BASE>
+BigInteger<BASE> operator+(BigInteger<BASE>&& lhs, const BigInteger<BASE>& rhs) {return std::move(lhs += rhs);}
+template<unsigned long long BASE>
+BigInteger<BASE> operator+(const BigInteger<BASE>& lhs, BigInteger<BASE>&& rhs) {return std::move(rhs += lhs);}
+template<unsigned long long BASE>
+BigInteger<BASE> operator+(BigInteger<BASE>&& lhs, BigInteger<BASE>&& rhs) {return std::move(lhs += rhs);}
+template<unsigned long long BASE>
+BigInteger<BASE> operator-(BigInteger<BASE>&& lhs, const BigInteger<BASE>& rhs) {return std::move(lhs -= rhs);}
+template<unsigned long long BASE>
+BigInteger<BASE> operator-(BigInteger<BASE>&& lhs, BigInteger<BASE>&& rhs) {return std::move(lhs -= rhs);}
 
 template<unsigned long long BASE>
-const BigInteger<BASE> operator*(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs) {
+BigInteger<BASE> operator*(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs) {
+	if(&lhs == &rhs) return square(lhs);
 	if(lhs.isNan()) return lhs;
 	else if(rhs.isNan()) return rhs;
 
@@ -91,59 +105,152 @@ const BigInteger<BASE> operator*(const BigInteger<BASE>& lhs, const BigInteger<B
 		return res;
 	}
 	
-	BigInteger<BASE> mnrl(lhs);
-	BigInteger<BASE> mnrr(rhs);
-
-	mnrl.abs();
-	mnrr.abs();
-
-	int sizel = mnrl.capacity();
-	int sizer = mnrr.capacity();
-
-	if(sizel < sizer) 
-		while(sizel < sizer) sizel = mnrl.expand();
-	else 
-		while(sizer < sizel) sizer = mnrr.expand();
-
-	if(sizel == 1) {
-		mnrl[0] *= mnrr[0];
-		for(int index = 0; index < sizel; ++index) {
-			if(mnrl[index] < mnrl.base())
-				continue;
-			if(index+1 >= sizel)
-				sizel = mnrl.expand();
-			mnrl[index+1] += mnrl[index] / mnrl.base();
-			mnrl[index] %= mnrl.base();
-		}
-		mnrl.updRealSize();
+	typedef typename BigInteger<BASE>::typev typev;
+	typedef typename BigInteger<BASE>::kernel kernel;
+
+	int rsizel = lhs.realSize();
+	int rsizer = rhs.realSize();
+	int threshold = BIS::Threshold<typev>::karatsuba;
+	if(rsizel < threshold || rsizer < threshold || rsizel + rsizer == 2) {//schoolbook
+		BigInteger<BASE> res;
+		res.reserve(rsizel + rsizer);
+		if(rsizel >= rsizer)
+			kernel::mul(&res[0], &lhs._a[0], rsizel, &rhs._a[0], rsizer);
+		else
+			kernel::mul(&res[0], &rhs._a[0], rsizer, &lhs._a[0], rsizel);
+		res.updRealSize();
+		res._sign = !(lhs.sign() ^ rhs.sign());
+		return res;
+	}
+	int rsizemin = (rsizel < rsizer) ? rsizel : rsizer;
+	if(rsizemin >= BIS::Threshold<typev>::ntt && 
+		(rsizel + rsizer)*BigInteger<BASE>::NTTDIGITS <= BIS::Convolution::maxLength) {//larger products split by Toom-4 first
+		BigInteger<BASE> res = BigInteger<BASE>::ntt(lhs, rhs);
+		res._sign = !(lhs.sign() ^ rhs.sign());
+		return res;
+	}
+	if(rsizemin >= BIS::Threshold<typev>::toom3 && rsizemin >= 16/*pieces must outgrow point values*/) {
+		const BigInteger<BASE>& a = (rsizel >= rsizer) ? lhs : rhs;
+		const BigInteger<BASE>& b = (rsizel >= rsizer) ? rhs : lhs;
+		int rsizemax = a.realSize();
+		BigInteger<BASE> res = 
+			(rsizemax >= 2*rsizemin) ? BigInteger<BASE>::unbalanced(a, b) : 
+			(4*rsizemax >= 5*rsizemin) ? BigInteger<BASE>::toom32(a, b) : 
+			(rsizemin >= BIS::Threshold<typev>::toom4) ? BigInteger<BASE>::toom4(lhs, rhs) : BigInteger<BASE>::toom3(lhs, rhs);
+		res._sign = !(lhs.sign() ^ rhs.sign());
+		return res;
 	}
-	else {
-		BigInteger<BASE> majl = mnrl.bisection();
-		BigInteger<BASE> majr = mnrr.bisection();
-		BigInteger<BASE> suml(majl);
-		BigInteger<BASE> sumr(majr);
 
-		suml.plus_bit(mnrl);//must be majl.capacity() == mnrl.capacity() == sizel/2
-		sumr.plus_bit(mnrr);//|9|9|9|9|(plus_bit)|9|9|9|9| = |19|9|9|8|
+	//Karatsuba on the limbs, one scratch buffer for the whole recursion
+	const BigInteger<BASE>& a = (rsizel >= rsizer) ? lhs : rhs;
+	const BigInteger<BASE>& b = (rsizel >= rsizer) ? rhs : lhs;
+	int an = a.realSize();
+	int bn = b.realSize();
+	typedef typename BigInteger<BASE>::karatsuba karatsuba;
+	typename BigInteger<BASE>::buffer w;
+	w.resize(karatsuba::scratch(an, bn, threshold));
+	BigInteger<BASE> res;
+	res.reserve(an + bn);
+	karatsuba::mul(&res[0], &a._a[0], an, &b._a[0], bn, &w[0], threshold);
+	res.updRealSize();
+	res._sign = !(lhs.sign() ^ rhs.sign());
+	return res;
+}
 
-		suml = suml*sumr;//recursion
-		majl = majl*majr;//recursion
-		mnrl = mnrl*mnrr;//recursion
+//big*big: symmetric schoolbook, Karatsuba, Toom and NTT squaring
+template<unsigned long long BASE>
+BigInteger<BASE> square(const BigInteger<BASE>& big) {
+	if(big.isNan()) return big;
 
-		mnrl += (majl<<sizel) + ((suml-(majl+mnrl))<<(sizel>>1));
+	BigInteger<BASE> res;
+	if(big.isInf()) {
+		res.setInf();
+		return res;
 	}
-	mnrl._sign = !(lhs.sign() ^ rhs.sign());
-	return mnrl;
+	
+	typedef typename BigInteger<BASE>::typev typev;
+	typedef typename BigInteger<BASE>::kernel kernel;
+
+	int rsize = big.realSize();
+	if(rsize < BIS::Threshold<typev>::karatsuba || rsize == 1) {//schoolbook
+		res.reserve(2*rsize);
+		kernel::sqr(&res[0], &big._a[0], rsize);
+		res.updRealSize();
+		return res;
+	}
+	if(rsize >= BIS::Threshold<typev>::ntt && 
+		2*rsize*BigInteger<BASE>::NTTDIGITS <= BIS::Convolution::maxLength) 
+		return BigInteger<BASE>::ntt(big, big);
+	if(rsize >= BIS::Threshold<typev>::toom3 && rsize >= 16) 
+		return (rsize >= BIS::Threshold<typev>::toom4) ? 
+			BigInteger<BASE>::toom4(big, big) : BigInteger<BASE>::toom3(big, big);
+	typedef typename BigInteger<BASE>::karatsuba karatsuba;
+	typename BigInteger<BASE>::buffer w;
+	w.resize(karatsuba::scratch(rsize, BIS::Threshold<typev>::karatsuba));
+	res.reserve(2*rsize);
+	karatsuba::sqr(&res[0], &big._a[0], rsize, &w[0], BIS::Threshold<typev>::karatsuba);
+	res.updRealSize();
+	return res;
+}
+
+//fused accumulation into acc, no temporaries while the signs agree
+template<unsigned long long BASE>
+BigInteger<BASE>& addMul(BigInteger<BASE>& acc, const BigInteger<BASE>& a, const BigInteger<BASE>& b) {//acc += a*b
+	return BigInteger<BASE>::mulAcc(acc, a, b, true);
+}
+template<unsigned long long BASE>
+BigInteger<BASE>& subMul(BigInteger<BASE>& acc, const BigInteger<BASE>& a, const BigInteger<BASE>& b) {//acc -= a*b
+	return BigInteger<BASE>::mulAcc(acc, a, b, false);
+}
+template<unsigned long long BASE>
+BigInteger<BASE>& addMulLimb(BigInteger<BASE>& acc, const BigInteger<BASE>& a, unsigned long long m) {//acc += a*m, m < base
+	typedef typename BigInteger<BASE>::typev typev;
+	typedef typename BigInteger<BASE>::kernel kernel;
+	if(!acc.isReal() || !a.isReal() || &acc == &a) 
+		return acc += a*BigInteger<BASE>(m, true);
+	if(m == 0 || a.isNull()) 
+		return acc;
+	int an = a.realSize();
+	if(acc.isNull() || acc.sign() == a.sign()) {
+		int rsize = acc.realSize();
+		int size = (rsize > an) ? rsize : an;
+		acc.reserve(size+1);
+		typev carry = kernel::addMulLimb(&acc._a[0], &a._a[0], an, static_cast<typev>(m));
+		kernel::add(&acc._a[an], &acc._a[an], size+1-an, &carry, 1);
+		acc._sign = a.sign();
+		acc.updRealSize();
+		return acc;
+	}
+	BigInteger<BASE> p;
+	p.reserve(an+1);
+	p._a[an] = kernel::mulLimb(&p._a[0], &a._a[0], an, static_cast<typev>(m));
+	p.updRealSize();
+	acc.addSpan(&p._a[0], p.realSize(), 0, a.sign());
+	return acc;
+}
+template<unsigned long long BASE>
+BigInteger<BASE>& addShifted(BigInteger<BASE>& acc, const BigInteger<BASE>& x, int shift) {//acc += x*base^shift
+	if(!acc.isReal() || !x.isReal() || &acc == &x) 
+		return acc += x << shift;
+	acc.addSpan(&x._a[0], x.realSize(), shift, x.sign());
+	return acc;
+}
+template<unsigned long long BASE>
+BigInteger<BASE>& subShifted(BigInteger<BASE>& acc, const BigInteger<BASE>& x, int shift) {//acc -= x*base^shift
+	if(!acc.isReal() || !x.isReal() || &acc == &x) 
+		return acc -= x << shift;
+	acc.addSpan(&x._a[0], x.realSize(), shift, !x.sign());
+	return acc;
 }
 
 template<unsigned long long BASE>
-const BigInteger<BASE> operator/(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs) {
+BigInteger<BASE> operator/(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs) {
 	std::pair< BigInteger<BASE>, BigInteger<BASE> > res = divide(lhs,rhs);
 	return res.first;
 }
 
 template<unsigned long long BASE>
-const BigInteger<BASE> operator%(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs) {
+BigInteger<BASE> operator%(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs) {
 	std::pair< BigInteger<BASE>, BigInteger<BASE> > res = divide(lhs,rhs);
 	return res.second;
 }
@@ -197,15 +304,13 @@ std::pair< BigInteger<BASE>, BigInteger<BASE> > divide(const BigInteger<BASE>& l
 		r = lhs;
 		return res;
 	}
-	unsigned long long base = q.base();
+	typedef typename BigInteger<BASE>::typev typev;
+	typedef typename BigInteger<BASE>::kernel kernel;
+	typedef typename BigInteger<BASE>::limb::dtypev dtypev;
+	const dtypev base = BigInteger<BASE>::limb::base();
 	if(n == 1) {
 		q.reserve(m);
-		r[0] = 0;
-		for(int j = m-1; j >= 0; --j) {
-			r[0] = r[0]*q.base() + lhs[j];
-			q[j] = r[0]/rhs[0];
-			r[0] -= q[j]*rhs[0];
-		}
+		r[0] = kernel::divLimb(&q[0], &lhs._a[0], m, typename BigInteger<BASE>::divisor(rhs[0]));
 		q.updRealSize();
 		q.shrink();
 		q._sign = !(lhs.sign()^rhs.sign());	
@@ -214,90 +319,68 @@ std::pair< BigInteger<BASE>, BigInteger<BASE> > divide(const BigInteger<BASE>& l
 		return res;
 	}
 
-	BigInteger<BASE> un(lhs);
-	BigInteger<BASE> vn(rhs);
-	un.abs();
-	vn.abs();
-
-	un.reserve(m+1);
-	vn.reserve(n);
-
-	q.reserve(m-n+1);
-	r.reserve(n);
-
-	typename BigInteger<BASE>::bit qhat;
-	typename BigInteger<BASE>::bit tmp;
-	typename BigInteger<BASE>::bit rhat;
-
-	for(int j = m-n; j >= 0; --j) {
-		tmp = un[j+n]*base + un[j+n-1];
-		qhat = tmp/vn[n-1];
-		rhat = tmp - qhat*vn[n-1];
-		
-		while(qhat >= base || qhat*vn[n-2] > base*rhat + un[j+n-2]) {
-			qhat -= 1;
-			rhat += vn[n-1];
-			if(rhat >= base) break;
-		}
-		// *&-
-		for(int i = 0; i < n; ++i) {
-			un[i+j] -= qhat*vn[i];
-
-			un[i+j+1] += un[i+j] / base;
-			un[i+j] %= base;
-			if(un[i+j] < 0) {//< +0
-				un[i+j] += base;
-				un[i+j+1] -= 1;
-			}
-		}
-
-		q[j] = qhat;
-		if(un[n+j] < 0) {//< +0
-			q[j] -= 1;
-			for(int i = 0; i < n; ++i) {
-				un[i+j] += vn[i];
-				un[i+j+1] += un[i+j] / base;
-				un[i+j] %= base;
-			}
-		}
+	int threshold = (BIS::Threshold<typev>::division < 2) ? 2 : BIS::Threshold<typev>::division;
+	if(n < threshold || m-n < threshold) {
+		BigInteger<BASE>::divKnuth(lhs, rhs, q, r);
+	}
+	else {//normalize, so that the recursion needs few corrections
+		typev d = static_cast<typev>(base/(static_cast<dtypev>(rhs[n-1]) + 1));
+		BigInteger<BASE> un;
+		BigInteger<BASE> vn;
+		un.reserve(m+1);
+		vn.reserve(n);
+		un[m] = kernel::mulLimb(&un[0], &lhs._a[0], m, d);
+		kernel::mulLimb(&vn[0], &rhs._a[0], n, d);
+		un.updRealSize();
+		vn.updRealSize();
+		BigInteger<BASE> rn;
+		BigInteger<BASE>::divRecursive(un, vn, q, rn);
+		int rsize = rn.realSize();
+		r.reserve(rsize);
+		kernel::divLimb(&r[0], &rn._a[0], rsize, typename BigInteger<BASE>::divisor(d));//unnormalize remainder
+		r.updRealSize();
 	}
-	q.updRealSize();
-	un.updRealSize();
-	q.shrink();
-	r = un;
 	q._sign = !(lhs.sign()^rhs.sign());	
 	r._sign = q.sign();	
 	return res;
 }
 
 template<unsigned long long BASE>
-const BigInteger<BASE> operator<<(const BigInteger<BASE>& lhs, int shift) {return BigInteger<BASE>(lhs)<<=shift;}
+BigInteger<BASE> operator<<(const BigInteger<BASE>& lhs, int shift) {return std::move(BigInteger<BASE>(lhs) <<= shift);}
+template<unsigned long long BASE>
+BigInteger<BASE> operator>>(const BigInteger<BASE>& lhs, int shift) {return std::move(BigInteger<BASE>(lhs) >>= shift);}
 template<unsigned long long BASE>
-const BigInteger<BASE> operator>>(const BigInteger<BASE>& lhs, int shift) {return BigInteger<BASE>(lhs)>>=shift;}
+BigInteger<BASE> operator<<(BigInteger<BASE>&& lhs, int shift) {return std::move(lhs <<= shift);}
+template<unsigned long long BASE>
+BigInteger<BASE> operator>>(BigInteger<BASE>&& lhs, int shift) {return std::move(lhs >>= shift);}
 
 template<unsigned long long BASE, typename X>
-const BigInteger<BASE> operator+(const X& lhs, const BigInteger<BASE>& rhs) {return BigInteger<BASE>(lhs)+=rhs;}
+BigInteger<BASE> operator+(const X& lhs, const BigInteger<BASE>& rhs) {return std::move(BigInteger<BASE>(rhs) += lhs);}
 template<unsigned long long BASE, typename X>
-const BigInteger<BASE> operator-(const X& lhs, const BigInteger<BASE>& rhs) {return BigInteger<BASE>(lhs)-=rhs;}
+BigInteger<BASE> operator-(const X& lhs, const BigInteger<BASE>& rhs) {return std::move(BigInteger<BASE>(rhs, true) += lhs);}
 template<unsigned long long BASE, typename X>
-const BigInteger<BASE> operator*(const X& lhs, const BigInteger<BASE>& rhs) {return BigInteger<BASE>(lhs)*rhs;}
+BigInteger<BASE> operator*(const X& lhs, const BigInteger<BASE>& rhs) {return std::move(BigInteger<BASE>(rhs) *= lhs);}
 template<unsigned long long BASE, typename X>
-const BigInteger<BASE>  operator/(const X& lhs, const BigInteger<BASE>& rhs) {return BigInteger<BASE>(lhs) / rhs;}
+BigInteger<BASE> operator/(const X& lhs, const BigInteger<BASE>& rhs) {return BigInteger<BASE>(lhs) / rhs;}
 template<unsigned long long BASE, typename X>
-const BigInteger<BASE>  operator%(const X& lhs, const BigInteger<BASE>& rhs) {return BigInteger<BASE>(lhs) % rhs;}
+BigInteger<BASE> operator%(const X& lhs, const BigInteger<BASE>& rhs) {return BigInteger<BASE>(lhs) % rhs;}
 template<unsigned long long BASE, typename X>
 std::pair< BigInteger<BASE>, BigInteger<BASE> > divide(const X& lhs, const BigInteger<BASE>& rhs) {return divide(BigInteger<BASE>(lhs), rhs);}
 
 template<unsigned long long BASE, typename Y>
-const BigInteger<BASE> operator+(const BigInteger<BASE>& lhs, const Y& rhs) {return BigInteger<BASE>(lhs)+=rhs;}
+BigInteger<BASE> operator+(const BigInteger<BASE>& lhs, const Y& rhs) {return std::move(BigInteger<BASE>(lhs) += rhs);}
+template<unsigned long long BASE, typename Y>
+BigInteger<BASE> operator-(const BigInteger<BASE>& lhs, const Y& rhs) {return std::move(BigInteger<BASE>(lhs) -= rhs);}
+template<unsigned long long BASE, typename Y>
+BigInteger<BASE> operator+(BigInteger<BASE>&& lhs, const Y& rhs) {return std::move(lhs += rhs);}
 template<unsigned long long BASE, typename Y>
-const BigInteger<BASE> operator-(const BigInteger<BASE>& lhs, const Y& rhs) {return BigInteger<BASE>(lhs) -= rhs;}
+BigInteger<BASE> operator-(BigInteger<BASE>&& lhs, const Y& rhs) {return std::move(lhs -= rhs);}
 template<unsigned long long BASE, typename Y>
-const BigInteger<BASE> operator*(const BigInteger<BASE>& lhs, const Y& rhs) {return lhs*BigInteger<BASE>(rhs);}
+BigInteger<BASE> operator*(const BigInteger<BASE>& lhs, const Y& rhs) {return std::move(BigInteger<BASE>(lhs) *= rhs);}
 template<unsigned long long BASE, typename Y>
-const BigInteger<BASE>  operator/(const BigInteger<BASE>& lhs, const Y& rhs) {return lhs / BigInteger<BASE>(rhs);}
+BigInteger<BASE> operator/(const BigInteger<BASE>& lhs, const Y& rhs) {return std::move(BigInteger<BASE>(lhs) /= rhs);}
 template<unsigned long long BASE, typename Y>
-const BigInteger<BASE>  operator%(const BigInteger<BASE>& lhs, const Y& rhs) {return lhs % BigInteger<BASE>(rhs);}
+BigInteger<BASE> operator%(const BigInteger<BASE>& lhs, const Y& rhs) {return std::move(BigInteger<BASE>(lhs) %= rhs);}
 template<unsigned long long BASE, typename Y>
 std::pair< BigInteger<BASE>, BigInteger<BASE> > divide(const BigInteger<BASE>& lhs, const Y& rhs) {return divide(lhs, BigInteger<BASE>(rhs));}
 
@@ -347,29 +430,29 @@ template<unsigned long long BASE>
 bool operator!=(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs) {return (lhs.isNan()||rhs.isNan())? true:  !(lhs == rhs);}
 
 template<unsigned long long BASE, typename X>
-bool operator<(const X& lhs, const BigInteger<BASE>& rhs) {return BigInteger<BASE>(lhs) < rhs;}
+bool operator<(const X& lhs, const BigInteger<BASE>& rhs) {return rhs > lhs;}
 template<unsigned long long BASE, typename X>
-bool operator>(const X& lhs, const BigInteger<BASE>& rhs) {return BigInteger<BASE>(lhs) > rhs;}
+bool operator>(const X& lhs, const BigInteger<BASE>& rhs) {return rhs < lhs;}
 template<unsigned long long BASE, typename X>
-bool operator==(const X& lhs, const BigInteger<BASE>& rhs) {return BigInteger<BASE>(lhs) == rhs;}
+bool operator==(const X& lhs, const BigInteger<BASE>& rhs) {return rhs == lhs;}
 template<unsigned long long BASE, typename X>
-bool operator<=(const X& lhs, const BigInteger<BASE>& rhs) {return BigInteger<BASE>(lhs) <= rhs;}
+bool operator<=(const X& lhs, const BigInteger<BASE>& rhs) {return rhs >= lhs;}
 template<unsigned long long BASE, typename X>
-bool operator>=(const X& lhs, const BigInteger<BASE>& rhs) {return BigInteger<BASE>(lhs) >= rhs;}
+bool operator>=(const X& lhs, const BigInteger<BASE>& rhs) {return rhs <= lhs;}
 template<unsigned long long BASE, typename X>
-bool operator!=(const X& lhs, const BigInteger<BASE>& rhs) {return BigInteger<BASE>(lhs) != rhs;}
+bool operator!=(const X& lhs, const BigInteger<BASE>& rhs) {return rhs != lhs;}
 
 template<unsigned long long BASE, typename Y>
-bool operator<(const BigInteger<BASE>& lhs, const Y& rhs) {return lhs < BigInteger<BASE>(rhs);}
+bool operator<(const BigInteger<BASE>& lhs, const Y& rhs) {return lhs.compare(rhs) == -1;}
 template<unsigned long long BASE, typename Y>
-bool operator>(const BigInteger<BASE>& lhs, const Y& rhs) {return lhs > BigInteger<BASE>(rhs);}
+bool operator>(const BigInteger<BASE>& lhs, const Y& rhs) {return lhs.compare(rhs) == 1;}
 template<unsigned long long BASE, typename Y>
-bool operator==(const BigInteger<BASE>& lhs, const Y& rhs) {return lhs == BigInteger<BASE>(rhs);}
+bool operator==(const BigInteger<BASE>& lhs, const Y& rhs) {return lhs.compare(rhs) == 0;}
 template<unsigned long long BASE, typename Y>
-bool operator<=(const BigInteger<BASE>& lhs, const Y& rhs) {return lhs <= BigInteger<BASE>(rhs);}
+bool operator<=(const BigInteger<BASE>& lhs, const Y& rhs) {int flag = lhs.compare(rhs); return flag == -1 || flag == 0;}
 template<unsigned long long BASE, typename Y>
-bool operator>=(const BigInteger<BASE>& lhs, const Y& rhs) {return lhs >= BigInteger<BASE>(rhs);}
+bool operator>=(const BigInteger<BASE>& lhs, const Y& rhs) {int flag = lhs.compare(rhs); return flag == 0 || flag == 1;}
 template<unsigned long long BASE, typename Y>
-bool operator!=(const BigInteger<BASE>& lhs, const Y& rhs) {return lhs != BigInteger<BASE>(rhs);}
+bool operator!=(const BigInteger<BASE>& lhs, const Y& rhs) {return lhs.compare(rhs) != 0;}
 
 #endif
@@ -0,0 +1,306 @@
+/*
+Copyright (C) 2014 Ilya Arkhipovsky
+This file is part of BigInteger.
+( Implementation of long arithmetic. The base of the system of numeration is any integer from 2 to 1 << ((sizeof(unsigned long long)<<2)-1) )
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Contact e-mail <arkhipovsky.ilya@yandex.ru>
+*/
+
+#ifndef BIG_INTEGER_GCD_HPP
+#define BIG_INTEGER_GCD_HPP
+
+//gcd
+template<unsigned long long BASE>
+struct BigInteger<BASE>::cofactors {//(a, b; c, d), the identity at first
+	BigInteger a, b, c, d;
+	cofactors() : a(1), b(0), c(0), d(1) {}
+};
+
+template<unsigned long long BASE>
+template<typename T>
+void BigInteger<BASE>::combine(BigInteger<BASE>& x, BigInteger<BASE>& y, const T& a, const T& b, const T& c, const T& d) {
+	BigInteger nx = x*a;
+	nx += y*b;
+	BigInteger ny = x*c;
+	ny += y*d;
+	x = std::move(nx);
+	y = std::move(ny);
+}
+template<unsigned long long BASE>
+void BigInteger<BASE>::combine(BigInteger<BASE>& x, BigInteger<BASE>& y, const cofactors& m) {
+	combine(x, y, m.a, m.b, m.c, m.d);
+}
+template<unsigned long long BASE>
+void BigInteger<BASE>::combine(cofactors& m, const cofactors& l) {//m = l*m
+	combine(m.a, m.c, l.a, l.b, l.c, l.d);
+	combine(m.b, m.d, l.a, l.b, l.c, l.d);
+}
+template<unsigned long long BASE>
+void BigInteger<BASE>::order(BigInteger<BASE>& a, BigInteger<BASE>& b, cofactors* m) {//a >= b >= 0, the rows of m follow
+	if(!a.sign()) {
+		a.abs();
+		if(m) {
+			m->a.invertSign();
+			m->b.invertSign();
+		}
+	}
+	if(!b.sign()) {
+		b.abs();
+		if(m) {
+			m->c.invertSign();
+			m->d.invertSign();
+		}
+	}
+	if(a.smallerAbs(b)) {
+		std::swap(a, b);
+		if(m) {
+			std::swap(m->a, m->c);
+			std::swap(m->b, m->d);
+		}
+	}
+}
+template<unsigned long long BASE>
+unsigned long long BigInteger<BASE>::leadingBits(const BigInteger<BASE>& x, int shift, int count) {//count bits of |x| from shift
+	const int bits = (BITS > 0) ? static_cast<int>(BITS) : 1;
+	unsigned long long res = 0;
+	int rsize = x.realSize();
+	for(int pos = shift; pos < shift+count;) {
+		int index = pos / bits;
+		int offset = pos % bits;
+		int take = (bits - offset < shift+count - pos) ? bits - offset : shift+count - pos;
+		if(index < rsize) 
+			res |= ((static_cast<unsigned long long>(x._a[index]) >> offset) & ((1ULL << take) - 1)) << (pos - shift);
+		pos += take;
+	}
+	return res;
+}
+//Knuth's algorithm L: the quotients of the leading parts are taken while both bounds agree,
+//the cofactors then advance a and b by several Euclid steps at once; one division step if none agree
+template<unsigned long long BASE>
+void BigInteger<BASE>::lehmerStep(BigInteger<BASE>& a, BigInteger<BASE>& b, cofactors* m) {
+	const long long top = 1LL << 62;
+	long long ah = 0, bh = 0;
+	int rsize = a.realSize();
+	if(BITS > 0) {
+		int length = a.bitLength();
+		int shift = (length > 62) ? length - 62 : 0;
+		ah = static_cast<long long>(leadingBits(a, shift, length - shift));
+		bh = static_cast<long long>(leadingBits(b, shift, length - shift));
+	}
+	else {
+		int index = rsize-1;
+		for(; index >= 0 && ah <= (top - 1 - static_cast<long long>(a._a[index])) / static_cast<long long>(LIMB); --index) 
+			ah = ah*static_cast<long long>(LIMB) + static_cast<long long>(a._a[index]);
+		int bsize = b.realSize();
+		for(int j = rsize-1; j > index; --j) 
+			bh = bh*static_cast<long long>(LIMB) + ((j < bsize) ? static_cast<long long>(b._a[j]) : 0);
+	}
+	long long A = 1, B = 0, C = 0, D = 1;
+	while(bh + C != 0 && bh + D != 0) {
+		long long q = (ah + A) / (bh + C);
+		if(q != (ah + B) / (bh + D)) 
+			break;
+		long long t = A - q*C;
+		A = C;
+		C = t;
+		t = B - q*D;
+		B = D;
+		D = t;
+		t = ah - q*bh;
+		ah = bh;
+		bh = t;
+	}
+	if(B == 0) {
+		std::pair<BigInteger, BigInteger> qr = divide(a, b);
+		a = std::move(b);
+		b = std::move(qr.second);
+		if(m) {
+			cofactors l;
+			l.a = 0;
+			l.b = 1;
+			l.c = 1;
+			qr.first.invertSign();
+			l.d = std::move(qr.first);
+			combine(*m, l);
+		}
+	}
+	else {
+		combine(a, b, A, B, C, D);
+		if(m) {
+			combine(m->a, m->c, A, B, C, D);
+			combine(m->b, m->d, A, B, C, D);
+		}
+	}
+	order(a, b, m);
+}
+//a >= b >= 0 of n limbs are reduced until b has n/2 + 1 limbs at most, m collects the steps
+//the first half of the steps comes from the top n - n/2 limbs, the rest from the top limbs of what is left;
+//a matrix found on the top limbs may overshoot on the full numbers, order() keeps them nonnegative
+//and the determinant stays +-1, so only the speed depends on it
+template<unsigned long long BASE>
+void BigInteger<BASE>::halfGcd(BigInteger<BASE>& a, BigInteger<BASE>& b, cofactors* m) {
+	int n = a.realSize();
+	int s = n/2 + 1;
+	if(b.isNull() || b.realSize() <= s) 
+		return;
+	if(n < BIS::Threshold<typev>::gcd) {
+		while(!b.isNull() && b.realSize() > s) 
+			lehmerStep(a, b, m);
+		return;
+	}
+	int k = n/2;
+	cofactors l;
+	BigInteger x = a >> k, y = b >> k;
+	halfGcd(x, y, &l);
+	if(!l.b.isNull()) {
+		combine(a, b, l);
+		order(a, b, &l);
+		if(m) 
+			combine(*m, l);
+	}
+	while(!b.isNull() && b.realSize() > s) {
+		int size = a.realSize();
+		int shift = 2*s - size;
+		if(shift <= 0 || size - shift < BIS::Threshold<typev>::gcd) {
+			lehmerStep(a, b, m);
+			continue;
+		}
+		l = cofactors();
+		x = a >> shift;
+		y = b >> shift;
+		halfGcd(x, y, &l);
+		if(l.b.isNull()) {//no steps on the top limbs
+			lehmerStep(a, b, m);
+			continue;
+		}
+		combine(a, b, l);
+		order(a, b, &l);
+		if(m) 
+			combine(*m, l);
+	}
+}
+template<unsigned long long BASE>
+BigInteger<BASE> BigInteger<BASE>::gcdCore(BigInteger<BASE>& a, BigInteger<BASE>& b, cofactors* m) {//a >= b >= 0
+	while(!b.isNull()) {
+		int size = b.realSize();
+		if(size >= BIS::Threshold<typev>::gcd && size > a.realSize()/2 + 1) 
+			halfGcd(a, b, m);
+		else 
+			lehmerStep(a, b, m);
+	}
+	return a;
+}
+
+template<unsigned long long BASE>
+BigInteger<BASE> gcd(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs) {//>= 0, Nan if one is not real
+	BigInteger<BASE> a(lhs), b(rhs);
+	if(!a.isReal() || !b.isReal()) {
+		a.setNan();
+		return a;
+	}
+	BigInteger<BASE>::order(a, b, 0);
+	return BigInteger<BASE>::gcdCore(a, b, 0);
+}
+template<unsigned long long BASE>
+BigInteger<BASE> xgcd(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs, BigInteger<BASE>& x, BigInteger<BASE>& y) {//g = lhs*x + rhs*y, 0 <= x < |rhs|/g
+	typedef typename BigInteger<BASE>::cofactors cofactors;
+	BigInteger<BASE> a(lhs), b(rhs);
+	if(!a.isReal() || !b.isReal()) {
+		a.setNan();
+		x.setNan();
+		y.setNan();
+		return a;
+	}
+	cofactors m;
+	a.abs();
+	b.abs();
+	BigInteger<BASE>::order(a, b, &m);//a = m.a*|lhs| + m.b*|rhs|
+	BigInteger<BASE> g = BigInteger<BASE>::gcdCore(a, b, &m);
+	x = std::move(m.a);
+	y = std::move(m.b);
+	if(!lhs.sign()) 
+		x.invertSign();
+	if(!rhs.sign()) 
+		y.invertSign();
+	if(g.isNull()) {
+		x = 0;
+		y = 0;
+		return g;
+	}
+	if(!rhs.isNull()) {//the smallest x >= 0, y follows exactly
+		BigInteger<BASE> period = rhs / g;
+		period.abs();
+		x = BigInteger<BASE>::residue(x, period);
+		y = (g - lhs*x) / rhs;
+	}
+	if(x.isNull()) 
+		x.abs();
+	if(y.isNull()) 
+		y.abs();
+	return g;
+}
+template<unsigned long long BASE>
+BigInteger<BASE> modinv(const BigInteger<BASE>& x, const BigInteger<BASE>& mod) {//1/x mod |mod| in [0, |mod|), Nan if gcd(x, mod) != 1
+	BigInteger<BASE> u, v;
+	BigInteger<BASE> g = xgcd(x, mod, u, v);
+	if(!g.isReal() || mod.isNull() || g.compare(1ULL, true) != 0) {
+		g.setNan();
+		return g;
+	}
+	BigInteger<BASE> m(mod);
+	m.abs();
+	return BigInteger<BASE>::residue(u, m);
+}
+//Montgomery's trick: one inversion of the product, three multiplications per value
+//if the product is not invertible every value is inverted alone, the ones without an inverse are Nan
+template<unsigned long long BASE>
+vector< BigInteger<BASE> > modinv(const vector< BigInteger<BASE> >& values, const BigInteger<BASE>& mod) {
+	int count = static_cast<int>(values.size());
+	vector< BigInteger<BASE> > res(count);
+	if(count == 0) 
+		return res;
+	Modulus<BASE> ctx(mod);
+	vector< BigInteger<BASE> > prefix(count);//values[0]*..*values[i] mod |mod|
+	bool invertible = ctx.value().isReal() && !ctx.value().isNull();
+	for(int index = 0; index < count && invertible; ++index) {
+		if(!values[index].isReal()) 
+			invertible = false;
+		else if(index == 0) 
+			ctx.reduce(prefix[0], values[0]);
+		else 
+			ctx.mulmod(prefix[index], prefix[index-1], values[index]);
+	}
+	BigInteger<BASE> inv;
+	if(invertible) {
+		inv = modinv(prefix[count-1], ctx.value());
+		invertible = inv.isReal();
+	}
+	if(!invertible) {
+		for(int index = 0; index < count; ++index) 
+			res[index] = modinv(values[index], mod);
+		return res;
+	}
+	BigInteger<BASE> t;
+	for(int index = count-1; index > 0; --index) {
+		ctx.mulmod(res[index], inv, prefix[index-1]);
+		ctx.mulmod(t, inv, values[index]);
+		std::swap(inv, t);
+	}
+	res[0] = std::move(inv);
+	return res;
+}
+
+#endif
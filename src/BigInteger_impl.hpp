@@ -44,13 +44,12 @@ void BigInteger<BASE>::updRealSize(int shift) const {//realSize >= 1, realSize <
 		_realSize += shift;
 }
 template<unsigned long long BASE>
-void BigInteger<BASE>::reserve(int n) {
+void BigInteger<BASE>::reserve(int n) {//exactly n limbs unless growing by a few
 	int size = capacity();
 	if(n <= size) 
 		return;
-	while(n > size) 
-		size = increaseSizeRule(size);
-	resize(size);
+	size = increaseSizeRule(size);
+	resize((n > size) ? n : size);
 }
 template<unsigned long long BASE>
 void BigInteger<BASE>::shrink() {//shrink vector _a
@@ -73,12 +72,8 @@ BigInteger<BASE>& BigInteger<BASE>::operator<<=(int shift) {
 		return *this;
 
 	if(shift > 0) {
-		int size = capacity();
 		int realsize = realSize();
-		while(realsize + shift > size)
-			size = expand();
-		if(realsize == 1 && _a[0] == 0) 
-			return *this;
+		reserve(realsize + shift);
 		for(int index = realsize-1; index >= 0; --index) 
 			_a[index+shift] = _a[index];
 		for(int index = shift-1; index >= 0; --index)
@@ -120,6 +115,20 @@ BigInteger<BASE>& BigInteger<BASE>::operator>>=(int shift) {
 	}
 }
 template<unsigned long long BASE>
+typename BigInteger<BASE>::typev BigInteger<BASE>::divLimb(const divisor& d) {
+	if(!isReal()) 
+		return 0;
+	typev rest = kernel::divLimb(&_a[0], &_a[0], realSize(), d);
+	updRealSize();
+	return rest;
+}
+template<unsigned long long BASE>
+typename BigInteger<BASE>::typev BigInteger<BASE>::modLimb(const divisor& d) const {
+	if(!isReal()) 
+		return 0;
+	return kernel::modLimb(&_a[0], realSize(), d);
+}
+template<unsigned long long BASE>
 BigInteger<BASE>& BigInteger<BASE>::plus(const BigInteger<BASE>& rhs) {
 	if(isNan() || rhs.isNan()) {
 		setNan(); 
@@ -130,48 +139,22 @@ BigInteger<BASE>& BigInteger<BASE>::plus(const BigInteger<BASE>& rhs) {
 		return *this;
 	}
 	
-	int sizelhs = capacity();
-	int sizerhs = rhs.capacity();
-	while(sizelhs < sizerhs) 
-		sizelhs = expand();
 	int rsizel = realSize();
 	int rsizer = rhs.realSize();
-	for(int index = 0; index < rsizer; ++index) 
-		_a[index] += rhs[index];
-	if(rsizer > rsizel) {
-		updRealSize(rsizer - rsizel);
-		rsizel = rsizer;
-	}
-
-	for(int index = 0; index < rsizel-1; ++index) {//carry
-		if(_a[index] < base()) 
-			continue;
-		_a[index+1] += 1;
-		_a[index] -= base();
-	}
+	int rsize = (rsizel > rsizer) ? rsizel : rsizer;
+	reserve(rsize);
 
-	if(_a[rsizel-1] >= base()) {
-		if(rsizel >= sizelhs) 
-			sizelhs = expand();
-		_a[rsizel] += 1;
-		_a[rsizel-1] -= base();
-		updRealSize(1);
+	typev carry;
+	if(rsizel >= rsizer) 
+		carry = kernel::add(&_a[0], &_a[0], rsizel, &rhs._a[0], rsizer);
+	else 
+		carry = kernel::add(&_a[0], &rhs._a[0], rsizer, &_a[0], rsizel);
+	if(carry) {
+		if(rsize >= capacity()) 
+			expand();
+		_a[rsize++] = carry;
 	}
-	return *this;
-}
-template<unsigned long long BASE>
-BigInteger<BASE>& BigInteger<BASE>::plus_bit(const BigInteger<BASE>& rhs) {//lhs.capacity() == rhs.capacity()
-	int size = capacity();
-
-	for(int index = 0; index < size; ++index) 
-		_a[index] += rhs._a[index];
-
-	for(int index = 0; index < size - 1; ++index)
-		if(_a[index] >= base()) {
-			_a[index+1] += 1;
-			_a[index] -= base();
-		}
-	updRealSize();
+	_realSize = rsize;
 	return *this;
 }
 template<unsigned long long BASE>
@@ -185,9 +168,10 @@ BigInteger<BASE>& BigInteger<BASE>::minus(const BigInteger<BASE>& rhs) {
 			setNan();
 		return *this;
 	}
-	else if(rhs.isInf()) {
-		*this = rhs;
-		invertSign();
+	else if(rhs.isInf()) {//the result has the sign opposite to *this in both x + (-Inf) and x - Inf
+		bool sign = !this->sign();
+		setInf();
+		_sign = sign;
 		return *this;
 	}
 	
@@ -197,50 +181,540 @@ BigInteger<BASE>& BigInteger<BASE>::minus(const BigInteger<BASE>& rhs) {
 		*this = 0;
 		return *this;
 	}
-	int size = capacity();
-	int maxrealsize, minrealsize;
 	if(flag < 0) {//rhs < *this
-		minrealsize = rhs.realSize();
-		maxrealsize = realSize();
-		for(int index = 0; index < minrealsize; ++index) {
-			_a[index] -= rhs._a[index];
-		}
+		kernel::sub(&_a[0], &_a[0], realSize(), &rhs._a[0], rhs.realSize());
 	}
 	else {
-		minrealsize = realSize();
-		maxrealsize = rhs.realSize();
-		int sizerhs = rhs.capacity();
-		while(size < sizerhs) size = expand();
-		for(int index = 0; index < maxrealsize; ++index) {
-			_a[index] = rhs._a[index] - _a[index];
-		}
+		reserve(rhs.realSize());
+		kernel::sub(&_a[0], &rhs._a[0], rhs.realSize(), &_a[0], realSize());
 		invertSign();
 	}
-
-	for(int index = 0; index < maxrealsize-1; ++index) {//carry
-		if(_a[index] < 0) {
-			_a[index] += base();
-			_a[index+1] -= 1;
+	updRealSize();
+	shrink();
+	return *this;
+}
+template<unsigned long long BASE>
+BigInteger<BASE> BigInteger<BASE>::slice(int begin, int count) const {
+	BigInteger tmp;
+	int rsize = realSize();
+	if(begin >= rsize) 
+		return tmp;
+	if(begin + count > rsize) 
+		count = rsize - begin;
+	tmp.reserve(count);
+	for(int index = 0; index < count; ++index)
+		tmp._a[index] = _a[begin+index];
+	tmp.updRealSize();
+	return tmp;
+}
+template<unsigned long long BASE>
+void BigInteger<BASE>::addSpan(const typev* x, int n, int shift, bool sign) {
+	if(n == 1 && x[0] == 0) 
+		return;
+	int rsize = realSize();
+	if(isNull() || this->sign() == sign) {//|*this| += |x|*base^shift
+		int size = (rsize > n+shift) ? rsize : n+shift;
+		reserve(size);
+		typev carry = kernel::add(&_a[shift], &_a[shift], size-shift, x, n);
+		if(carry) {
+			reserve(size+1);
+			_a[size] = carry;
 		}
+		_sign = sign;
+		updRealSize();
+		return;
 	}
-	if(flag > 0 || _a[maxrealsize-1] == 0) {
+	int flag = (rsize != n+shift) ? (rsize > n+shift ? 1 : -1) : kernel::compare(&_a[shift], x, n);
+	for(int index = 0; index < shift && flag == 0; ++index) 
+		if(_a[index] != 0) flag = 1;
+	if(flag >= 0) {//|*this| -= |x|*base^shift
+		kernel::sub(&_a[shift], &_a[shift], rsize-shift, x, n);
 		updRealSize();
+		if(isNull()) 
+			_sign = true;//x-x = +0
 		shrink();
 	}
+	else {//|*this| = |x|*base^shift - |*this|
+		BigInteger tmp;
+		tmp.reserve(n+shift);
+		for(int index = 0; index < n; ++index) 
+			tmp._a[shift+index] = x[index];
+		kernel::sub(&tmp._a[0], &tmp._a[0], n+shift, &_a[0], rsize);
+		tmp.updRealSize();
+		tmp._sign = sign;
+		*this = std::move(tmp);
+	}
+}
+template<unsigned long long BASE>
+BigInteger<BASE>& BigInteger<BASE>::mulAcc(BigInteger<BASE>& acc, const BigInteger<BASE>& a, const BigInteger<BASE>& b, bool add) {
+	bool sign = !(a.sign() ^ b.sign()) == add;
+	if(!acc.isReal() || !a.isReal() || !b.isReal() || &acc == &a || &acc == &b) 
+		return add ? (acc += a*b) : (acc -= a*b);
+	if(a.isNull() || b.isNull()) 
+		return acc;
+	int an = a.realSize();
+	int bn = b.realSize();
+	const BigInteger& lng = (an >= bn) ? a : b;
+	const BigInteger& shrt = (an >= bn) ? b : a;
+	int ln = lng.realSize();
+	int sn = shrt.realSize();
+	if(sn < BIS::Threshold<typev>::karatsuba && (acc.isNull() || acc.sign() == sign)) {//rows of a*b go straight into acc
+		int rsize = acc.realSize();
+		int size = (rsize > an+bn) ? rsize : an+bn;
+		acc.reserve(size+1);
+		for(int j = 0; j < sn; ++j) {
+			typev carry = kernel::addMulLimb(&acc._a[j], &lng._a[0], ln, shrt._a[j]);
+			kernel::add(&acc._a[j+ln], &acc._a[j+ln], size+1-j-ln, &carry, 1);
+		}
+		acc._sign = sign;
+		acc.updRealSize();
+		return acc;
+	}
+	BigInteger p = a*b;
+	acc.addSpan(&p._a[0], p.realSize(), 0, sign);
+	return acc;
+}
+
+template<unsigned long long BASE>
+int BigInteger<BASE>::nativeLimbs(typev* a, unsigned long long u) {
+	int n = 0;
+	do {
+		a[n++] = limb::split(u);
+	} while(u != 0);
+	return n;
+}
+template<unsigned long long BASE>
+BigInteger<BASE>& BigInteger<BASE>::addNative(unsigned long long u, bool sign) {
+	if(!isReal()) {
+		if(isNan()) 
+			setNan();
+		return *this;
+	}
+	if(u == 0) {
+		if(isNull() && this->sign() != sign) 
+			_sign = true;//(-0) + (+0) = +0
+		return *this;
+	}
+	typev a[NATIVELIMBS];
+	int n = nativeLimbs(a, u);
+	addSpan(a, n, 0, sign);
 	return *this;
 }
 template<unsigned long long BASE>
-BigInteger<BASE> BigInteger<BASE>::bisection() {
-	BigInteger tmp(*this);
-	int size = capacity()>>1;
+BigInteger<BASE>& BigInteger<BASE>::mulNative(unsigned long long u, bool sign) {
+	if(!isReal() || isNull() || u == 0) 
+		return (*this) *= BigInteger(u, sign);
+	typev a[NATIVELIMBS];
+	int n = nativeLimbs(a, u);
 	int rsize = realSize();
-	tmp >>= (size);
-	tmp.resize(size);
+	if(n == 1) {
+		reserve(rsize+1);
+		_a[rsize] = kernel::mulLimb(&_a[0], &_a[0], rsize, a[0]);
+		_realSize = (_a[rsize] != 0) ? rsize+1 : rsize;
+	}
+	else {
+		BigInteger res;
+		res.reserve(rsize + n);
+		kernel::mul(&res._a[0], &_a[0], rsize, a, n);
+		res.updRealSize();
+		res._sign = _sign;
+		(*this) = std::move(res);
+	}
+	_sign = !(this->sign() ^ sign);
+	return *this;
+}
+template<unsigned long long BASE>
+BigInteger<BASE>& BigInteger<BASE>::divNative(unsigned long long u, bool sign, bool remainder) {//the signs follow divide()
+	typev a[NATIVELIMBS];
+	int n = nativeLimbs(a, u);
+	if(!isReal() || isNull() || u == 0 || n > 1) 
+		return (*this) = remainder ? (*this) % BigInteger(u, sign) : (*this) / BigInteger(u, sign);
+	int rsize = realSize();
+	typev rest = kernel::divLimb(&_a[0], &_a[0], rsize, a[0]);
+	if(remainder) {
+		for(int index = 1; index < rsize; ++index) 
+			_a[index] = 0;
+		_a[0] = rest;
+		_realSize = 1;
+	}
+	else {
+		updRealSize();
+	}
+	shrink();
+	_sign = !(this->sign() ^ sign);
+	return *this;
+}
+//convert
+template<unsigned long long BASE>
+template<unsigned long long BASE2>
+vector<const BigInteger<BASE>*> BigInteger<BASE>::convertPowers(int levels) {
+	static BIS::PowerTable<BigInteger> table;
+	BigInteger<BASE2> src;
+	BigInteger first;
+	if(src.base() == 0) //1 << (8*sizeof(typev)) of BASE2
+		first = square(BigInteger(1ULL<<(src.bitsize()/2), true));
+	else 
+		first = BigInteger(static_cast<unsigned long long>(src.base()), true);
+	return table.powers(first, levels, 0);
+}
+template<unsigned long long BASE>
+template<unsigned long long BASE2>
+BigInteger<BASE> BigInteger<BASE>::convertRange(const BigInteger<BASE2>& cpy, int begin, int count, const vector<const BigInteger*>& powers) {
+	if(count <= 16) {//Horner
+		BigInteger res;
+		for(int index = begin+count-1; index >= begin; --index) {
+			res = res*(*powers[0]);
+			res += BigInteger(static_cast<unsigned long long>(cpy.index(index)), true);
+		}
+		return res;
+	}
+	int level = 0;
+	while((2 << level) < count) 
+		++level;
+	int half = 1 << level;
+	BigInteger res = convertRange(cpy, begin+half, count-half, powers)*(*powers[level]);//recursion
+	res += convertRange(cpy, begin, half, powers);//recursion
+	return res;
+}
+//independent products of the Toom points and of the blocks, forked above BIS::Threshold<typev>::parallel limbs
+template<unsigned long long BASE>
+void BigInteger<BASE>::products(BigInteger<BASE>* res, const BigInteger<BASE>* u, const BigInteger<BASE>* v, int count, int size) {
+	auto product = [&](int index) {res[index] = v ? u[index]*v[index] : square(u[index]);};
+	if(size >= BIS::Threshold<typev>::parallel) 
+		BIS::ThreadPool::forEach(count, product);
+	else 
+		for(int index = 0; index < count; ++index) 
+			product(index);
+}
+//Toom-3: a = a0 + a1*x + a2*x^2, x = base^k
+//c = a*b = c0 + c1*x + c2*x^2 + c3*x^3 + c4*x^4, points 0, 1, -1, 2, inf
+//c2 = (c(1) + c(-1))/2 - c0 - c4
+//c1 + c3 = (c(1) - c(-1))/2
+//c1 + 4*c3 = (c(2) - c0 - 4*c2 - 16*c4)/2
+template<unsigned long long BASE>
+BigInteger<BASE> BigInteger<BASE>::toom3(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs) {
+	int rsizel = lhs.realSize();
+	int rsizer = rhs.realSize();
+	int k = ((rsizel > rsizer ? rsizel : rsizer) + 2)/3;
 
-	resize(size);
-	if(rsize > size)
-		updRealSize(size-rsize);
-	return tmp;
+	BigInteger a0 = lhs.slice(0, k), a1 = lhs.slice(k, k), a2 = lhs.slice(2*k, k);
+	BigInteger b0 = rhs.slice(0, k), b1 = rhs.slice(k, k), b2 = rhs.slice(2*k, k);
+	BigInteger ae = a0 + a2;//a(1) = ae + a1, a(-1) = ae - a1
+	BigInteger be = b0 + b2;
+	bool sqr = (&lhs == &rhs);
+
+	BigInteger u[5] = {ae + a1, ae - a1, (a2*2 + a1)*2 + a0, std::move(a0), std::move(a2)};
+	BigInteger v[5];
+	if(!sqr) {
+		BigInteger point[5] = {be + b1, be - b1, (b2*2 + b1)*2 + b0, std::move(b0), std::move(b2)};
+		std::move(point, point+5, v);
+	}
+	BigInteger c[5];
+	products(c, u, sqr ? 0 : v, 5, k);//recursion
+	BigInteger& p1 = c[0];
+	BigInteger& m1 = c[1];
+	BigInteger& p2 = c[2];
+	BigInteger& c0 = c[3];
+	BigInteger& c4 = c[4];
+
+	BigInteger c2 = (p1 + m1)/2 - c0 - c4;
+	BigInteger o1 = (p1 - m1)/2;
+	BigInteger c3 = ((p2 - c0 - c2*4 - c4*16)/2 - o1)/3;
+	BigInteger c1 = o1 - c3;
+
+	addShifted(c0, c1, k);
+	addShifted(c0, c2, 2*k);
+	addShifted(c0, c3, 3*k);
+	addShifted(c0, c4, 4*k);
+	return std::move(c0);
+}
+//Toom-4: a = a0 + a1*x + a2*x^2 + a3*x^3, x = base^k, c = c0 + ... + c6*x^6
+//points 0, 1, -1, 2, -2, 3, inf
+//c2 + c4 = (c(1) + c(-1))/2 - c0 - c6,               c1 + c3 + c5 = (c(1) - c(-1))/2
+//c2 + 4*c4 = ((c(2) + c(-2))/2 - c0 - 64*c6)/4,       c1 + 4*c3 + 16*c5 = (c(2) - c(-2))/4
+//c1 + 9*c3 + 81*c5 = (c(3) - c0 - 9*c2 - 81*c4 - 729*c6)/3
+template<unsigned long long BASE>
+BigInteger<BASE> BigInteger<BASE>::toom4(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs) {
+	int rsizel = lhs.realSize();
+	int rsizer = rhs.realSize();
+	int k = ((rsizel > rsizer ? rsizel : rsizer) + 3)/4;
+
+	BigInteger a0 = lhs.slice(0, k), a1 = lhs.slice(k, k), a2 = lhs.slice(2*k, k), a3 = lhs.slice(3*k, k);
+	BigInteger b0 = rhs.slice(0, k), b1 = rhs.slice(k, k), b2 = rhs.slice(2*k, k), b3 = rhs.slice(3*k, k);
+	BigInteger ae1 = a0 + a2, ao1 = a1 + a3;//a(1) = ae1 + ao1, a(-1) = ae1 - ao1
+	BigInteger be1 = b0 + b2, bo1 = b1 + b3;
+	BigInteger ae2 = a0 + a2*4, ao2 = (a1 + a3*4)*2;//a(2) = ae2 + ao2, a(-2) = ae2 - ao2
+	BigInteger be2 = b0 + b2*4, bo2 = (b1 + b3*4)*2;
+	bool sqr = (&lhs == &rhs);
+
+	BigInteger u[7] = {ae1 + ao1, ae1 - ao1, ae2 + ao2, ae2 - ao2, ((a3*3 + a2)*3 + a1)*3 + a0, std::move(a0), std::move(a3)};
+	BigInteger v[7];
+	if(!sqr) {
+		BigInteger point[7] = {be1 + bo1, be1 - bo1, be2 + bo2, be2 - bo2, ((b3*3 + b2)*3 + b1)*3 + b0, std::move(b0), std::move(b3)};
+		std::move(point, point+7, v);
+	}
+	BigInteger c[7];
+	products(c, u, sqr ? 0 : v, 7, k);//recursion
+	BigInteger& p1 = c[0];
+	BigInteger& m1 = c[1];
+	BigInteger& p2 = c[2];
+	BigInteger& m2 = c[3];
+	BigInteger& p3 = c[4];
+	BigInteger& c0 = c[5];
+	BigInteger& c6 = c[6];
+
+	BigInteger e1 = (p1 + m1)/2 - c0 - c6;
+	BigInteger o1 = (p1 - m1)/2;
+	BigInteger e2 = ((p2 + m2)/2 - c0 - c6*64)/4;
+	BigInteger o2 = (p2 - m2)/4;
+	BigInteger c4 = (e2 - e1)/3;
+	BigInteger c2 = e1 - c4;
+	BigInteger o3 = (p3 - c0 - c2*9 - c4*81 - c6*729)/3;
+	BigInteger d1 = (o2 - o1)/3;//c3 + 5*c5
+	BigInteger d2 = (o3 - o2)/5;//c3 + 13*c5
+	BigInteger c5 = (d2 - d1)/8;
+	BigInteger c3 = d1 - c5*5;
+	BigInteger c1 = o1 - c3 - c5;
+
+	addShifted(c0, c1, k);
+	addShifted(c0, c2, 2*k);
+	addShifted(c0, c3, 3*k);
+	addShifted(c0, c4, 4*k);
+	addShifted(c0, c5, 5*k);
+	addShifted(c0, c6, 6*k);
+	return std::move(c0);
+}
+//Toom-2.5: a = a0 + a1*x + a2*x^2, b = b0 + b1*x, x = base^k, c = c0 + ... + c3*x^3
+//points 0, 1, -1, inf: c2 = (c(1) + c(-1))/2 - c0, c1 + c3 = (c(1) - c(-1))/2
+template<unsigned long long BASE>
+BigInteger<BASE> BigInteger<BASE>::toom32(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs) {
+	int rsizel = lhs.realSize();
+	int rsizer = rhs.realSize();
+	int k = (rsizel + 2)/3;
+	if(2*k < rsizer) 
+		k = (rsizer + 1)/2;
+
+	BigInteger a0 = lhs.slice(0, k), a1 = lhs.slice(k, k), a2 = lhs.slice(2*k, k);
+	BigInteger b0 = rhs.slice(0, k), b1 = rhs.slice(k, k);
+	BigInteger ae = a0 + a2;
+
+	BigInteger u[4] = {ae + a1, ae - a1, std::move(a0), std::move(a2)};
+	BigInteger v[4] = {b0 + b1, b0 - b1, std::move(b0), std::move(b1)};
+	BigInteger c[4];
+	products(c, u, v, 4, k);//recursion
+	BigInteger& p1 = c[0];
+	BigInteger& m1 = c[1];
+	BigInteger& c0 = c[2];
+	BigInteger& c3 = c[3];
+
+	BigInteger c2 = (p1 + m1)/2 - c0;
+	BigInteger c1 = (p1 - m1)/2 - c3;
+
+	addShifted(c0, c1, k);
+	addShifted(c0, c2, 2*k);
+	addShifted(c0, c3, 3*k);
+	return std::move(c0);
+}
+//lhs is cut into blocks as long as rhs, the balanced products are added at their offsets
+template<unsigned long long BASE>
+BigInteger<BASE> BigInteger<BASE>::unbalanced(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs) {
+	int rsizel = lhs.realSize();
+	int rsizer = rhs.realSize();
+	BigInteger b = rhs.slice(0, rsizer);
+	BigInteger res;
+	res.reserve(rsizel + rsizer);
+	if(rsizer >= BIS::Threshold<typev>::parallel && BIS::ThreadPool::active()) {//the blocks are multiplied at once
+		int count = (rsizel + rsizer - 1)/rsizer;
+		vector<BigInteger> c(count);
+		b.realSize();//found before the tasks share b
+		BIS::ThreadPool::forEach(count, [&](int index) {c[index] = lhs.slice(index*rsizer, rsizer)*b;});//recursion
+		for(int index = 0; index < count; ++index) 
+			addShifted(res, c[index], index*rsizer);
+		return res;
+	}
+	for(int begin = 0; begin < rsizel; begin += rsizer) 
+		addShifted(res, lhs.slice(begin, rsizer)*b, begin);//recursion
+	return res;
+}
+//three-prime NTT: limbs are cut into digits < 1 << 32 (native 64-bit limbs into halves)
+//the exact convolution is carried back into digits of base LIMB or 1 << 32
+template<unsigned long long BASE>
+BigInteger<BASE> BigInteger<BASE>::ntt(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs) {
+	const int digits = NTTDIGITS;
+	const unsigned long long radix = (LIMB == 0) ? (1ULL<<32) : LIMB;
+	const unsigned long long mask = 0xffffffffULL;
+	int rsizel = lhs.realSize();
+	int rsizer = rhs.realSize();
+	int an = rsizel*digits;
+	int bn = rsizer*digits;
+
+	vector<unsigned> a(an), b;
+	for(int index = 0; index < an; ++index)
+		a[index] = static_cast<unsigned>(lhs._a[index/digits] >> (32*(index%digits)));
+	if(&lhs != &rhs) {
+		b.resize(bn);
+		for(int index = 0; index < bn; ++index)
+			b[index] = static_cast<unsigned>(rhs._a[index/digits] >> (32*(index%digits)));
+	}
+	vector<unsigned> w;
+	BIS::Convolution::mul(w, &a[0], an, (&lhs == &rhs) ? &a[0] : &b[0], bn);
+
+	BigInteger res;
+	res.reserve(rsizel + rsizer);
+	int size = an + bn - 1;
+	unsigned long long carry[3] = {0, 0, 0};//base 1 << 32
+	unsigned long long t[4];
+	for(int k = 0; k < an + bn; ++k) {
+		unsigned long long s = carry[0] + ((k < size) ? w[3*k] : 0);
+		t[0] = s & mask;
+		s = (s >> 32) + carry[1] + ((k < size) ? w[3*k+1] : 0);
+		t[1] = s & mask;
+		s = (s >> 32) + carry[2] + ((k < size) ? w[3*k+2] : 0);
+		t[2] = s & mask;
+		t[3] = s >> 32;
+		unsigned long long rest = 0;
+		for(int index = 3; index >= 0; --index) {//t /= radix
+			unsigned long long cur = (rest << 32) | t[index];
+			t[index] = cur / radix;
+			rest = cur % radix;
+		}
+		carry[0] = t[0];
+		carry[1] = t[1];
+		carry[2] = t[2];
+		res._a[k/digits] |= static_cast<typev>(rest) << (32*(k%digits));
+	}
+	res.updRealSize();
+	return res;
+}
+
+//Knuth algorithm D, normalized divisor: vn[n-1] >= base/2
+template<unsigned long long BASE>
+void BigInteger<BASE>::divKnuth(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs, BigInteger<BASE>& q, BigInteger<BASE>& r) {
+	typedef typename limb::dtypev dtypev;
+	const dtypev base = limb::base();
+	int m = lhs.realSize();
+	int n = rhs.realSize();
+	q = 0;
+	if(m < n) {
+		r = lhs;
+		r.abs();
+		return;
+	}
+	if(n == 1) {//no second limb for qhat, the recursion gets here with a threshold of 2
+		q.reserve(m);
+		r = BigInteger(static_cast<unsigned long long>(kernel::divLimb(&q[0], &lhs._a[0], m, divisor(rhs[0]))), true);
+		q.updRealSize();
+		q.shrink();
+		return;
+	}
+	typev d = static_cast<typev>(base/(static_cast<dtypev>(rhs[n-1]) + 1));
+	BigInteger un;
+	BigInteger vn;
+	un.reserve(m+1);
+	vn.reserve(n);
+	un[m] = kernel::mulLimb(&un[0], &lhs._a[0], m, d);
+	kernel::mulLimb(&vn[0], &rhs._a[0], n, d);
+
+	q.reserve(m-n+1);
+	r = 0;
+	r.reserve(n);
+
+	dtypev qhat, rhat, tmp;
+	for(int j = m-n; j >= 0; --j) {
+		tmp = static_cast<dtypev>(un[j+n])*base + un[j+n-1];
+		qhat = tmp/vn[n-1];
+		rhat = tmp - qhat*vn[n-1];
+		
+		while(qhat >= base || qhat*vn[n-2] > base*rhat + un[j+n-2]) {
+			qhat -= 1;
+			rhat += vn[n-1];
+			if(rhat >= base) break;
+		}
+		// *&-
+		typev borrow = kernel::subMulLimb(&un[j], &vn[0], n, static_cast<typev>(qhat));
+		if(un[j+n] < borrow) {//qhat is one too large, add back
+			qhat -= 1;
+			kernel::add(&un[j], &un[j], n, &vn[0], n);
+		}
+		un[j+n] = 0;
+		q[j] = static_cast<typev>(qhat);
+	}
+	kernel::divLimb(&r[0], &un[0], n, divisor(d));//unnormalize remainder
+	q.updRealSize();
+	r.updRealSize();
+	q.shrink();
+}
+//recursive division (Burnikel-Ziegler, Zimmermann), x = base^k:
+//n-limb divisor B = B1*x + B0, (n+m)-limb dividend A, m <= n, k = m/2
+//A/x^2 = Q1*B1 + R1, A' = R1*x^2 + A%x^2 - Q1*B0*x, A' < 0 -> Q1 -= 1, A' += B*x
+//A'/x = Q0*B1 + R0, A'' = R0*x + A'%x - Q0*B0, A'' < 0 -> Q0 -= 1, A'' += B
+//q = Q1*x + Q0, r = A''; longer quotients are found by blocks of n limbs, lhs and rhs are positive;
+//shorter ones (n > m+1) from the top 2m+1 limbs of A and m+1 limbs of B, then q is at most 2 too large
+template<unsigned long long BASE>
+void BigInteger<BASE>::divRecursive(const BigInteger<BASE>& lhs, const BigInteger<BASE>& rhs, BigInteger<BASE>& q, BigInteger<BASE>& r) {
+	int n = rhs.realSize();
+	int m = lhs.realSize() - n;
+	int threshold = (BIS::Threshold<typev>::division < 2) ? 2 : BIS::Threshold<typev>::division;//k = m/2 > 0
+	if(n < threshold || m < threshold) {
+		divKnuth(lhs, rhs, q, r);
+		return;
+	}
+	if(m > n) {
+		int s = m;
+		BigInteger cur = lhs.slice(s, n);
+		BigInteger qi, ri;
+		q = 0;
+		while(s > 0) {
+			int t = (s < n) ? s : n;
+			s -= t;
+			cur <<= t;
+			cur += lhs.slice(s, t);
+			divRecursive(cur, rhs, qi, ri);
+			q <<= t;
+			q += qi;
+			cur = std::move(ri);
+		}
+		r = std::move(cur);
+		return;
+	}
+	if(n > m+1) {//the low limbs of B barely change q, the product q*B is unbalanced
+		int s = n-m-1;
+		BigInteger rs;
+		divRecursive(lhs.slice(s, lhs.realSize()-s), rhs.slice(s, n-s), q, rs);//recursion
+		r = lhs - q*rhs;
+		while(!r.sign() && !r.isNull()) {
+			q -= 1;
+			r += rhs;
+		}
+		return;
+	}
+
+	int k = m/2;
+	BigInteger b1 = rhs.slice(k, n-k), b0 = rhs.slice(0, k);
+	BigInteger q1, r1, q0, r0;
+
+	divRecursive(lhs.slice(2*k, lhs.realSize()), b1, q1, r1);//recursion
+	r1 <<= 2*k;
+	r1 += lhs.slice(0, 2*k);
+	r1 -= (q1*b0) << k;
+	while(!r1.sign() && !r1.isNull()) {
+		q1 -= 1;
+		r1 += rhs << k;
+	}
+
+	divRecursive(r1.slice(k, r1.realSize()), b1, q0, r0);//recursion
+	r0 <<= k;
+	r0 += r1.slice(0, k);
+	r0 -= q0*b0;
+	while(!r0.sign() && !r0.isNull()) {
+		q0 -= 1;
+		r0 += rhs;
+	}
+
+	q1 <<= k;
+	q1 += q0;
+	q = std::move(q1);
+	r = std::move(r0);
 }
 
 //compare
@@ -265,5 +739,32 @@ int BigInteger<BASE>::compareAbs(const BigInteger<BASE>& rhs) const {
 	}
 	return 0;//equalAbs == true, |*this| == |rhs|
 }
+template<unsigned long long BASE>
+int BigInteger<BASE>::compare(const BigInteger<BASE>& rhs) const {
+	if(isNan() || rhs.isNan()) 
+		return 2;
+	if(sign() != rhs.sign()) 
+		return sign() ? 1 : -1;//-0 < +0
+	int flag = compareAbs(rhs);
+	return sign() ? flag : -flag;
+}
+template<unsigned long long BASE>
+int BigInteger<BASE>::compare(unsigned long long u, bool sign) const {
+	if(isNan()) 
+		return 2;
+	if(this->sign() != sign) 
+		return this->sign() ? 1 : -1;
+	int flag;
+	if(isInf()) {
+		flag = 1;
+	}
+	else {
+		typev a[NATIVELIMBS];
+		int n = nativeLimbs(a, u);
+		int rsize = realSize();
+		flag = (rsize != n) ? (rsize > n ? 1 : -1) : kernel::compare(&_a[0], a, n);
+	}
+	return sign ? flag : -flag;
+}
 
 #endif
@@ -0,0 +1,593 @@
+/*
+Copyright (C) 2014 Ilya Arkhipovsky
+This file is part of BigInteger.
+( Implementation of long arithmetic. The base of the system of numeration is any integer from 2 to 1 << ((sizeof(unsigned long long)<<2)-1) )
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Contact e-mail <arkhipovsky.ilya@yandex.ru>
+*/
+
+#ifndef BIG_INTEGER_KERNEL_HPP
+#define BIG_INTEGER_KERNEL_HPP
+
+namespace BigIntegerSpace {
+	//double limb: holds a product of two limbs
+	template<typename T>
+	struct TraitsDouble {
+		typedef unsigned long long dtypev;
+	};
+#ifdef __SIZEOF_INT128__
+	template<> struct TraitsDouble<unsigned long long>{
+		typedef unsigned __int128 dtypev;
+	};
+#endif
+
+	//one digit of base B
+	//B*B + 2*B fits in unsigned long long (B <= 1 << BitSize<typev>::bitsize)
+	template<typename typev, unsigned long long B>
+	struct Limb {
+		typedef unsigned long long dtypev;
+
+		static dtypev base() {return B;}
+		static typev addc(typev a, typev b, typev& carry) {//a + b + carry
+			typev sum = a + b + carry;
+			carry = (sum >= B) ? 1 : 0;
+			return carry ? static_cast<typev>(sum - B) : sum;
+		}
+		static typev subb(typev a, typev b, typev& borrow) {//a - b - borrow
+			typev sub = b + borrow;
+			borrow = (a < sub) ? 1 : 0;
+			return borrow ? static_cast<typev>(a + (B - sub)) : static_cast<typev>(a - sub);
+		}
+		static typev mulAdd(typev a, typev b, typev c, typev& carry) {//a*b + c + carry
+			dtypev tmp = static_cast<dtypev>(a)*b + c + carry;
+			carry = static_cast<typev>(tmp / B);
+			return static_cast<typev>(tmp - static_cast<dtypev>(carry)*B);
+		}
+		static typev div(typev hi, typev lo, typev d, typev& rest) {//(hi*B + lo)/d, hi < d
+			dtypev tmp = static_cast<dtypev>(hi)*B + lo;
+			dtypev q = tmp / d;
+			rest = static_cast<typev>(tmp - q*d);
+			return static_cast<typev>(q);
+		}
+		static typev split(unsigned long long& u) {//u % B, u /= B
+			typev rest = static_cast<typev>(u % B);
+			u /= B;
+			return rest;
+		}
+	};
+
+	//B == 0: base is 1 << (8*sizeof(typev)), carries are taken from the overflow
+	template<typename typev>
+	struct Limb<typev, 0> {
+		typedef typename TraitsDouble<typev>::dtypev dtypev;
+		enum {
+			W = 8*sizeof(typev)
+		};
+
+		static dtypev base() {return static_cast<dtypev>(1)<<W;}
+		static typev addc(typev a, typev b, typev& carry) {
+			typev sum = a + carry;
+			typev out = (sum < carry) ? 1 : 0;
+			sum += b;
+			carry = out | ((sum < b) ? 1 : 0);
+			return sum;
+		}
+		static typev subb(typev a, typev b, typev& borrow) {
+			typev diff = a - b;
+			typev out = (a < b) ? 1 : 0;
+			typev res = diff - borrow;
+			borrow = out | ((diff < borrow) ? 1 : 0);
+			return res;
+		}
+		static typev mulAdd(typev a, typev b, typev c, typev& carry) {
+			dtypev tmp = static_cast<dtypev>(a)*b + c + carry;
+			carry = static_cast<typev>(tmp >> W);
+			return static_cast<typev>(tmp);
+		}
+		static typev div(typev hi, typev lo, typev d, typev& rest) {
+			dtypev tmp = (static_cast<dtypev>(hi)<<W) | lo;
+			dtypev q = tmp / d;
+			rest = static_cast<typev>(tmp - q*d);
+			return static_cast<typev>(q);
+		}
+		static typev split(unsigned long long& u) {
+			typev rest = static_cast<typev>(u);
+			u = (W >= 64) ? 0 : (u >> (W & 63));
+			return rest;
+		}
+	};
+
+	//invariant divisor 0 < d < B: the quotient is estimated by a multiplication with m = (2^64-1)/d
+	//(hi*B + lo) < 2^62, so the estimate is at most one too small
+	template<typename typev, unsigned long long B>
+	struct Reciprocal {
+		explicit Reciprocal(typev d = 1) : _d(d), _m(~0ULL / d) {}
+
+		typev divisor() const {return _d;}
+		typev div(typev hi, typev lo, typev& rest) const {//(hi*B + lo)/d, hi < d
+			unsigned long long u = static_cast<unsigned long long>(hi)*B + lo;
+			unsigned long long q = mulhi(u, _m);
+			unsigned long long r = u - q*_d;
+			if(r >= _d) {
+				++q;
+				r -= _d;
+			}
+			rest = static_cast<typev>(r);
+			return static_cast<typev>(q);
+		}
+	private:
+		static unsigned long long mulhi(unsigned long long a, unsigned long long b) {//(a*b) >> 64
+#ifdef __SIZEOF_INT128__
+			return static_cast<unsigned long long>((static_cast<unsigned __int128>(a)*b) >> 64);
+#else
+			const unsigned long long mask = 0xffffffffULL;
+			unsigned long long t = (a >> 32)*(b & mask) + (((a & mask)*(b & mask)) >> 32);
+			unsigned long long w = (a & mask)*(b >> 32) + (t & mask);
+			return (a >> 32)*(b >> 32) + (t >> 32) + (w >> 32);
+#endif
+		}
+
+		typev _d;
+		unsigned long long _m;
+	};
+	//B == 0: Granlund-Moller, d is normalized by _shift, v = (base^2-1)/dn - base
+	template<typename typev>
+	struct Reciprocal<typev, 0> {
+		typedef typename TraitsDouble<typev>::dtypev dtypev;
+		enum {
+			W = 8*sizeof(typev)
+		};
+
+		explicit Reciprocal(typev d = 1) : _d(d), _dn(d), _shift(0) {
+			while((_dn >> (W-1)) == 0) {
+				_dn <<= 1;
+				++_shift;
+			}
+			_v = static_cast<typev>(~static_cast<dtypev>(0) / _dn);//the high limb of the quotient is 1
+		}
+
+		typev divisor() const {return _d;}
+		typev div(typev hi, typev lo, typev& rest) const {//(hi*base + lo)/d, hi < d
+			typev u1 = _shift ? static_cast<typev>((hi << _shift) | (lo >> (W - _shift))) : hi;
+			typev u0 = static_cast<typev>(lo << _shift);
+			dtypev p = static_cast<dtypev>(_v)*u1 + ((static_cast<dtypev>(u1) + 1) << W) + u0;//mod base^2
+			typev q = static_cast<typev>(p >> W);
+			typev r = u0 - q*_dn;
+			if(r > static_cast<typev>(p)) {
+				--q;
+				r += _dn;
+			}
+			if(r >= _dn) {
+				++q;
+				r -= _dn;
+			}
+			rest = static_cast<typev>(r >> _shift);
+			return q;
+		}
+	private:
+		typev _d;
+		typev _dn;
+		typev _v;
+		int _shift;
+	};
+
+	//schoolbook product r = a*b, r has an+bn limbs and is neither a nor b
+	//columns are summed in unsigned long long and reduced by B after every terms products:
+	//the folds follow the sizes only, not the limbs
+	template<typename typev, unsigned long long B>
+	struct Basecase {
+		enum {
+			terms = (~0ULL - (B-1)) / ((B-1)*(B-1)) < 0x7fffffffULL ? static_cast<int>((~0ULL - (B-1)) / ((B-1)*(B-1))) : 0x7fffffff/*products added to a folded acc < B*/
+		};
+
+		static void mul(typev* r, const typev* a, int an, const typev* b, int bn) {
+			unsigned long long acc = 0;
+			unsigned long long carry = 0;
+			for(int k = 0; k < an+bn-1; ++k) {
+				int begin = (k < bn) ? 0 : k-bn+1;
+				int end = (k < an) ? k : an-1;
+				carry += acc / B;//the carry of the last column
+				acc %= B;
+				int count = 0;
+				for(int index = begin; index <= end; ++index) {
+					if(count == terms) {//fold before the column overflows
+						carry += acc / B;
+						acc %= B;
+						count = 0;
+					}
+					acc += static_cast<unsigned long long>(a[index])*b[k-index];
+					++count;
+				}
+				carry += acc / B;
+				r[k] = static_cast<typev>(acc % B);
+				acc = carry;
+				carry = 0;
+			}
+			r[an+bn-1] = static_cast<typev>(acc);
+		}
+		//r = a*a, r has 2*n limbs and is not a
+		//each column sums a[i]*a[k-i], i < k-i, once, then doubles it and adds the square a[k/2]^2
+		static void sqr(typev* r, const typev* a, int n) {
+			unsigned long long carry = 0;
+			for(int k = 0; k < 2*n-1; ++k) {
+				unsigned long long acc = 0;
+				unsigned long long high = 0;//acc + high*B is the sum of the cross products
+				int count = 0;
+				for(int index = (k < n) ? 0 : k-n+1; 2*index < k; ++index) {
+					if(count == terms) {
+						high += acc / B;
+						acc %= B;
+						count = 0;
+					}
+					acc += static_cast<unsigned long long>(a[index])*a[k-index];
+					++count;
+				}
+				high += acc / B;
+				acc = 2*(acc % B) + carry;
+				if((k & 1) == 0) 
+					acc += static_cast<unsigned long long>(a[k>>1])*a[k>>1];
+				r[k] = static_cast<typev>(acc % B);
+				carry = 2*high + acc / B;
+			}
+			r[2*n-1] = static_cast<typev>(carry);
+		}
+	};
+	//B == 0: rows of multiply-add, the carry is the high half of the double limb
+	template<typename typev>
+	struct Basecase<typev, 0> {
+		typedef Limb<typev, 0> limb;
+
+		static void mul(typev* r, const typev* a, int an, const typev* b, int bn) {
+			for(int j = 0; j < bn; ++j) {
+				typev carry = 0;
+				typev m = b[j];
+				if(j == 0) {
+					for(int index = 0; index < an; ++index)
+						r[index] = limb::mulAdd(a[index], m, 0, carry);
+				}
+				else {
+					for(int index = 0; index < an; ++index)
+						r[index+j] = limb::mulAdd(a[index], m, r[index+j], carry);
+				}
+				r[an+j] = carry;
+			}
+		}
+		//r = a*a: cross products a[i]*a[j], i < j, by rows, doubled, then the squares a[i]^2 on the diagonal
+		static void sqr(typev* r, const typev* a, int n) {
+			r[0] = 0;
+			r[2*n-1] = 0;
+			for(int i = 0; i < n-1; ++i) {
+				typev carry = 0;
+				typev m = a[i];
+				for(int index = i+1; index < n; ++index)
+					r[i+index] = limb::mulAdd(a[index], m, (i == 0) ? 0 : r[i+index], carry);
+				r[i+n] = carry;
+			}
+			typev carry = 0;
+			for(int index = 1; index < 2*n-1; ++index)//r *= 2
+				r[index] = limb::addc(r[index], r[index], carry);
+			r[2*n-1] = carry;
+			carry = 0;
+			for(int i = 0; i < n; ++i) {
+				typev high = 0;
+				typev low = limb::mulAdd(a[i], a[i], 0, high);
+				r[2*i] = limb::addc(r[2*i], low, carry);
+				r[2*i+1] = limb::addc(r[2*i+1], high, carry);
+			}
+		}
+	};
+
+	//loops over limb arrays, index 0 is the least significant limb
+	//r may be the same array as a or b
+	template<typename typev, unsigned long long B>
+	struct Kernel {
+		typedef Limb<typev, B> limb;
+
+		static typev add(typev* r, const typev* a, int an, const typev* b, int bn) {//r = a + b, an >= bn, returns carry
+			typev carry = 0;
+			int index = 0;
+			for(; index < bn; ++index)
+				r[index] = limb::addc(a[index], b[index], carry);
+			for(; index < an; ++index) {
+				if(carry == 0 && r == a)
+					break;
+				r[index] = limb::addc(a[index], 0, carry);
+			}
+			return carry;
+		}
+		static typev sub(typev* r, const typev* a, int an, const typev* b, int bn) {//r = a - b, an >= bn, returns borrow
+			typev borrow = 0;
+			int index = 0;
+			for(; index < bn; ++index)
+				r[index] = limb::subb(a[index], b[index], borrow);
+			for(; index < an; ++index) {
+				if(borrow == 0 && r == a)
+					break;
+				r[index] = limb::subb(a[index], 0, borrow);
+			}
+			return borrow;
+		}
+		static typev mulLimb(typev* r, const typev* a, int n, typev m) {//r = a*m, returns carry
+			typev carry = 0;
+			for(int index = 0; index < n; ++index)
+				r[index] = limb::mulAdd(a[index], m, 0, carry);
+			return carry;
+		}
+		static typev addMulLimb(typev* r, const typev* a, int n, typev m) {//r += a*m, returns carry
+			typev carry = 0;
+			for(int index = 0; index < n; ++index)
+				r[index] = limb::mulAdd(a[index], m, r[index], carry);
+			return carry;
+		}
+		static typev subMulLimb(typev* r, const typev* a, int n, typev m) {//r -= a*m, returns borrow
+			typev carry = 0;
+			typev borrow;
+			for(int index = 0; index < n; ++index) {
+				borrow = 0;
+				typev low = limb::mulAdd(a[index], m, 0, carry);
+				r[index] = limb::subb(r[index], low, borrow);
+				carry += borrow;//carry < B-1 when borrow can occur
+			}
+			return carry;
+		}
+		static void mul(typev* r, const typev* a, int an, const typev* b, int bn) {//r = a*b, r has an+bn limbs
+			Basecase<typev, B>::mul(r, a, an, b, bn);
+		}
+		static void sqr(typev* r, const typev* a, int n) {//r = a*a, r has 2*n limbs
+			Basecase<typev, B>::sqr(r, a, n);
+		}
+		static typev divLimb(typev* q, const typev* a, int n, typev d) {//q = a/d, returns a%d
+			typev rest = 0;
+			for(int index = n-1; index >= 0; --index)
+				q[index] = limb::div(rest, a[index], d, rest);
+			return rest;
+		}
+		static typev divLimb(typev* q, const typev* a, int n, const Reciprocal<typev, B>& d) {//q = a/d, returns a%d
+			typev rest = 0;
+			for(int index = n-1; index >= 0; --index)
+				q[index] = d.div(rest, a[index], rest);
+			return rest;
+		}
+		static typev modLimb(const typev* a, int n, const Reciprocal<typev, B>& d) {//a%d
+			typev rest = 0;
+			for(int index = n-1; index >= 0; --index)
+				d.div(rest, a[index], rest);
+			return rest;
+		}
+		static int compare(const typev* a, const typev* b, int n) {
+			for(int index = n-1; index >= 0; --index) {
+				if(a[index] < b[index]) return -1;
+				else if(a[index] > b[index]) return 1;
+			}
+			return 0;
+		}
+	};
+
+	//Karatsuba on limb spans: r = a*b, r has an+bn limbs and is neither a, b nor scratch
+	//the halves |a0-a1|, |b0-b1| are written to r, their product to scratch, then r gets z0 and z2
+	//scratch of n limbs: 2*ceil(n/2)+1 for the middle product and the same for the level below, about 2n in all
+	template<typename typev, unsigned long long B>
+	struct Karatsuba {
+		typedef Kernel<typev, B> kernel;
+
+		static int scratch(int n, int threshold) {//limbs of scratch for mul(r, a, n, b, n) and sqr(r, a, n)
+			int size = 0;
+			while(!basecase(n, threshold)) {
+				n -= n>>1;
+				size += 2*n+1;
+			}
+			return size;
+		}
+		static int scratch(int an, int bn, int threshold) {//an >= bn
+			if(an == bn || basecase(bn, threshold)) 
+				return scratch(bn, threshold);
+			int rem = an % bn;
+			int size = scratch(bn, threshold);
+			if(rem && !basecase(rem, threshold) && scratch(bn, rem, threshold) > size) 
+				size = scratch(bn, rem, threshold);
+			return 2*bn + size;
+		}
+		static void mul(typev* r, const typev* a, int an, const typev* b, int bn, typev* w, int threshold) {//an >= bn
+			if(an == bn) {
+				mul(r, a, b, bn, w, threshold);
+				return;
+			}
+			if(basecase(bn, threshold)) {
+				kernel::mul(r, a, an, b, bn);
+				return;
+			}
+			//unbalanced: a is cut into blocks of bn limbs, their products are added into r
+			mul(r, a, b, bn, w+2*bn, threshold);
+			for(int index = 2*bn; index < an+bn; ++index) 
+				r[index] = 0;
+			for(int begin = bn; begin < an; begin += bn) {
+				int count = (an - begin < bn) ? an - begin : bn;
+				if(count == bn) 
+					mul(w, a+begin, b, bn, w+2*bn, threshold);
+				else 
+					mul(w, b, bn, a+begin, count, w+2*bn, threshold);
+				kernel::add(r+begin, r+begin, an+bn-begin, w, count+bn);
+			}
+		}
+		static void mul(typev* r, const typev* a, const typev* b, int n, typev* w, int threshold) {//r has 2n limbs
+			if(basecase(n, threshold)) {
+				kernel::mul(r, a, n, b, n);
+				return;
+			}
+			if(n >= Threshold<typev>::parallel && ThreadPool::active()) {
+				mulParallel(r, a, b, n, w, threshold);
+				return;
+			}
+			int l = n>>1;
+			int h = n - l;//a = a0 + a1*base^l, a1 has h >= l limbs
+			bool sign = difference(r, a, l, h) == difference(r+h, b, l, h);
+			mul(w, r, r+h, h, w+2*h+1, threshold);//|a0-a1|*|b0-b1|
+			mul(r, a, b, l, w+2*h+1, threshold);//z0
+			mul(r+2*l, a+l, b+l, h, w+2*h+1, threshold);//z2
+			combine(r, w, l, h, sign);
+		}
+		static void sqr(typev* r, const typev* a, int n, typev* w, int threshold) {//r has 2n limbs
+			if(basecase(n, threshold)) {
+				kernel::sqr(r, a, n);
+				return;
+			}
+			if(n >= Threshold<typev>::parallel && ThreadPool::active()) {
+				sqrParallel(r, a, n, w, threshold);
+				return;
+			}
+			int l = n>>1;
+			int h = n - l;
+			difference(r, a, l, h);
+			sqr(w, r, h, w+2*h+1, threshold);//(a0-a1)^2
+			sqr(r, a, l, w+2*h+1, threshold);
+			sqr(r+2*l, a+l, h, w+2*h+1, threshold);
+			combine(r, w, l, h, true);
+		}
+	private:
+		static bool basecase(int n, int threshold) {return n < threshold || n < 4;}
+		//the three products go to the pool, z0 and z2 get scratch of their own,
+		//the differences are kept out of r, which z0 and z2 fill meanwhile
+		static void mulParallel(typev* r, const typev* a, const typev* b, int n, typev* w, int threshold) {
+			int l = n>>1;
+			int h = n - l;
+			int size = scratch(h, threshold);
+			vector<typev> t(2*h + 2*size);
+			typev* d = &t[0];
+			bool sign = difference(d, a, l, h) == difference(d+h, b, l, h);
+			ThreadPool::forEach(3, [&](int index) {
+				if(index == 0) 
+					mul(w, d, d+h, h, w+2*h+1, threshold);//|a0-a1|*|b0-b1|
+				else if(index == 1) 
+					mul(r, a, b, l, d+2*h, threshold);//z0
+				else 
+					mul(r+2*l, a+l, b+l, h, d+2*h+size, threshold);//z2
+			});
+			combine(r, w, l, h, sign);
+		}
+		static void sqrParallel(typev* r, const typev* a, int n, typev* w, int threshold) {
+			int l = n>>1;
+			int h = n - l;
+			int size = scratch(h, threshold);
+			vector<typev> t(h + 2*size);
+			typev* d = &t[0];
+			difference(d, a, l, h);
+			ThreadPool::forEach(3, [&](int index) {
+				if(index == 0) 
+					sqr(w, d, h, w+2*h+1, threshold);
+				else if(index == 1) 
+					sqr(r, a, l, d+h, threshold);
+				else 
+					sqr(r+2*l, a+l, h, d+h+size, threshold);
+			});
+			combine(r, w, l, h, true);
+		}
+		static bool difference(typev* d, const typev* a, int l, int h) {//d = |a0 - a1| of h limbs, true if a0 >= a1
+			bool less = (h > l && a[l+l] != 0) || kernel::compare(a, a+l, l) < 0;
+			if(less) {
+				kernel::sub(d, a+l, h, a, l);
+				return false;
+			}
+			kernel::sub(d, a, l, a+l, l);
+			if(h > l) 
+				d[l] = 0;
+			return true;
+		}
+		//r[0, 2l) = z0, r[2l, 2n) = z2, w[0, 2h) = |a0-a1|*|b0-b1|, sign: the product is subtracted
+		//r += (z0 + z2 -+ w)*base^l
+		static void combine(typev* r, typev* w, int l, int h, bool sign) {
+			int n = l + h;
+			typev top;
+			if(sign) {
+				top = 0;
+				top -= kernel::sub(w, r+2*l, 2*h, w, 2*h);//z2 - w, the borrow wraps top
+			}
+			else {
+				top = kernel::add(w, w, 2*h, r+2*l, 2*h);
+			}
+			top += kernel::add(w, w, 2*h, r, 2*l);
+			w[2*h] = top;
+			kernel::add(r+l, r+l, 2*n-l, w, 2*h+1);
+		}
+	};
+
+	//Montgomery reduction with R = B^n, m is odd in base B: gcd(m[0], B) == 1
+	//products come from Karatsuba (a threshold above n keeps them schoolbook, without data dependent branches),
+	//the reduction runs limb by limb and has no data dependent branches
+	template<typename typev, unsigned long long B>
+	struct Montgomery {
+		typedef Limb<typev, B> limb;
+		typedef Kernel<typev, B> kernel;
+
+		static bool invertible(typev m0) {//gcd(m0, B) == 1
+			if(B == 0) 
+				return (m0 & 1) != 0;
+			unsigned long long a = m0, b = B;
+			while(b != 0) {
+				unsigned long long t = a % b;
+				a = b;
+				b = t;
+			}
+			return a == 1;
+		}
+		static typev inverse(typev m0) {//-1/m0 mod B
+			if(B == 0) {//Newton: every step doubles the correct low bits of 1/m0
+				typev x = m0;
+				for(int bits = 3; bits < static_cast<int>(8*sizeof(typev)); bits <<= 1) 
+					x = static_cast<typev>(x*static_cast<typev>(2 - m0*x));
+				return static_cast<typev>(0 - x);
+			}
+			long long r0 = static_cast<long long>(B), r1 = m0, x0 = 0, x1 = 1;//x*m0 = r mod B
+			while(r1 != 0) {
+				long long q = r0 / r1, t = r0 - q*r1;
+				r0 = r1;
+				r1 = t;
+				t = x0 - q*x1;
+				x0 = x1;
+				x1 = t;
+			}
+			x0 %= static_cast<long long>(B);
+			return static_cast<typev>((x0 <= 0) ? -x0 : static_cast<long long>(B) - x0);
+		}
+		//r = t/R mod m, t has 2n+1 limbs and is destroyed, t < m*R, r has n limbs and is not t
+		//the last subtraction is masked: the time does not depend on t
+		static void redc(typev* r, typev* t, const typev* m, int n, typev minv) {
+			typev high = 0;
+			t[2*n] = 0;
+			for(int index = 0; index < n; ++index) {
+				typev carry = 0;
+				typev u = limb::mulAdd(t[index], minv, 0, carry);
+				carry = kernel::addMulLimb(t+index, m, n, u);
+				t[index+n] = limb::addc(t[index+n], carry, high);
+			}
+			t[2*n] = high;
+			typev borrow = kernel::sub(r, t+n, n, m, n);
+			typev keep = static_cast<typev>(0 - static_cast<typev>(borrow > t[2*n]));//t/R < m: r is t/R
+			for(int index = 0; index < n; ++index) 
+				r[index] = static_cast<typev>((r[index] & static_cast<typev>(~keep)) | (t[index+n] & keep));
+		}
+		static void mul(typev* r, const typev* a, const typev* b, const typev* m, int n, typev minv, typev* t, int threshold) {//r = a*b/R mod m, t has 2n+1+scratch(n) limbs
+			Karatsuba<typev, B>::mul(t, a, b, n, t+2*n+1, threshold);
+			redc(r, t, m, n, minv);
+		}
+		static void sqr(typev* r, const typev* a, const typev* m, int n, typev minv, typev* t, int threshold) {
+			Karatsuba<typev, B>::sqr(t, a, n, t+2*n+1, threshold);
+			redc(r, t, m, n, minv);
+		}
+		static int scratch(int n, int threshold) {return 2*n+1 + Karatsuba<typev, B>::scratch(n, threshold);}
+	};
+}
+
+#endif
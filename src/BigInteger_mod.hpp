@@ -0,0 +1,443 @@
+/*
+Copyright (C) 2014 Ilya Arkhipovsky
+This file is part of BigInteger.
+( Implementation of long arithmetic. The base of the system of numeration is any integer from 2 to 1 << ((sizeof(unsigned long long)<<2)-1) )
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Contact e-mail <arkhipovsky.ilya@yandex.ru>
+*/
+
+#ifndef BIG_INTEGER_MOD_HPP
+#define BIG_INTEGER_MOD_HPP
+
+//modular
+template<unsigned long long BASE>
+BigInteger<BASE> BigInteger<BASE>::residue(const BigInteger<BASE>& x, const BigInteger<BASE>& m) {//x mod m in [0, m), m > 0
+	BigInteger res;
+	if(x.isNull()) 
+		return res;
+	if(x.sign() && x.smallerAbs(m)) 
+		return x;
+	res = x % m;
+	if(!res.sign() && !res.isNull()) 
+		res += m;
+	res.abs();
+	return res;
+}
+template<unsigned long long BASE>
+int BigInteger<BASE>::windowBits(int bits) {//sliding window for an exponent of bits
+	return (bits <= 24) ? 1 : (bits <= 80) ? 3 : (bits <= 240) ? 4 : (bits <= 672) ? 5 : (bits <= 1792) ? 6 : 7;
+}
+template<unsigned long long BASE>
+BigInteger<BASE> BigInteger<BASE>::powModular(const BigInteger<BASE>& x, const BigInteger<BASE>& exp, const BigInteger<BASE>& mod, bool constTime) {
+	typedef BIS::Montgomery<typev, LIMB> montgomery;
+	BigInteger res;
+	if(!x.isReal() || !exp.isReal() || !mod.isReal() || mod.isNull()) {
+		res.setNan();
+		return res;
+	}
+	BigInteger m(mod);
+	m.abs();
+	bool inverse = !exp.sign() && !exp.isNull();//x^-e = (1/x)^e
+	BigInteger a = inverse ? modinv(x, m) : residue(x, m);
+	if(!a.isReal()) 
+		return a;
+	if(m.compare(1ULL, true) == 0) 
+		return res;
+	BigInteger<0> e;//the exponent is scanned by bits
+	e.convert(exp);
+	if(inverse) 
+		e = -e;
+	int bits = e.bitLength();
+	int n = m.realSize();
+	if(!montgomery::invertible(m._a[0])) {//left to right, a reduction by divide() after every step
+		if(constTime) {//divide() and the skipped multiplies depend on exp
+			res.setNan();
+			return res;
+		}
+		res = 1;
+		for(int index = bits-1; index >= 0; --index) {
+			res = residue(square(res), m);
+			if(e.testBit(index)) 
+				res = residue(res*a, m);
+		}
+		return res;
+	}
+	typev minv = montgomery::inverse(m._a[0]);
+	int threshold = constTime ? n+1 : BIS::Threshold<typev>::karatsuba;//constTime: schoolbook, Karatsuba compares the halves
+	int k = constTime ? 4 : windowBits(bits);
+	int count = constTime ? (1 << k) : (1 << (k-1));//constTime: a^0..a^(2^k-1), else the odd powers a^1, a^3, ..
+	buffer t, table, acc, sel;
+	t.resize(montgomery::scratch(n, threshold));
+	table.resize(count*n);
+	acc.resize(n);
+	sel.resize(n);
+	BigInteger one = residue(BigInteger(1) <<= n, m);//R mod m
+	BigInteger ar = residue(a << n, m);//a*R mod m
+	for(int index = 0; index < ar.realSize(); ++index) 
+		table[(constTime ? n : 0) + index] = ar._a[index];
+	for(int index = 0; index < one.realSize(); ++index) 
+		acc[index] = one._a[index];
+	if(constTime) {
+		for(int index = 0; index < n; ++index) 
+			table[index] = acc[index];
+		for(int j = 2; j < count; ++j) 
+			montgomery::mul(&table[j*n], &table[(j-1)*n], &table[n], &m._a[0], n, minv, &t[0], threshold);
+		//fixed windows over the length of the modulus as well, every window squares k times and multiplies once
+		int length = (bits > m.bitLength()) ? bits : m.bitLength();
+		length = (length + k-1) / k * k;
+		for(int index = length-k; index >= 0; index -= k) {
+			int value = 0;
+			for(int bit = index+k-1; bit >= index; --bit) 
+				value = (value << 1) | (e.testBit(bit) ? 1 : 0);
+			for(int j = 0; j < k; ++j) 
+				montgomery::sqr(&acc[0], &acc[0], &m._a[0], n, minv, &t[0], threshold);
+			for(int l = 0; l < n; ++l) 
+				sel[l] = 0;
+			for(int j = 0; j < count; ++j) {//every entry is read
+				typev mask = static_cast<typev>(0 - static_cast<typev>(j == value));
+				for(int l = 0; l < n; ++l) 
+					sel[l] = static_cast<typev>(sel[l] | (table[j*n+l] & mask));
+			}
+			montgomery::mul(&acc[0], &acc[0], &sel[0], &m._a[0], n, minv, &t[0], threshold);
+		}
+	}
+	else if(bits > 0) {
+		if(count > 1) {//a^2 in sel
+			montgomery::sqr(&sel[0], &table[0], &m._a[0], n, minv, &t[0], threshold);
+			for(int j = 1; j < count; ++j) 
+				montgomery::mul(&table[j*n], &table[(j-1)*n], &sel[0], &m._a[0], n, minv, &t[0], threshold);
+		}
+		bool started = false;
+		for(int index = bits-1; index >= 0;) {
+			if(!e.testBit(index)) {
+				montgomery::sqr(&acc[0], &acc[0], &m._a[0], n, minv, &t[0], threshold);
+				--index;
+				continue;
+			}
+			int low = (index-k+1 > 0) ? index-k+1 : 0;//the window ends with a set bit
+			while(!e.testBit(low)) 
+				++low;
+			int value = 0;
+			for(int bit = index; bit >= low; --bit) 
+				value = (value << 1) | (e.testBit(bit) ? 1 : 0);
+			if(started) {
+				for(int j = low; j <= index; ++j) 
+					montgomery::sqr(&acc[0], &acc[0], &m._a[0], n, minv, &t[0], threshold);
+				montgomery::mul(&acc[0], &acc[0], &table[(value>>1)*n], &m._a[0], n, minv, &t[0], threshold);
+			}
+			else {
+				for(int l = 0; l < n; ++l) 
+					acc[l] = table[(value>>1)*n+l];
+				started = true;
+			}
+			index = low-1;
+		}
+	}
+	for(int index = 0; index < n; ++index) {//out of the Montgomery form: acc*1/R
+		t[index] = acc[index];
+		t[index+n] = 0;
+	}
+	res.reserve(n);
+	montgomery::redc(&res._a[0], &t[0], &m._a[0], n, minv);
+	res.updRealSize();
+	return res;
+}
+
+template<unsigned long long BASE>
+BigInteger<BASE> powmod(const BigInteger<BASE>& x, const BigInteger<BASE>& exp, const BigInteger<BASE>& mod) {//x^exp mod |mod|, exp < 0 takes the inverse of x, Nan if there is none
+	return BigInteger<BASE>::powModular(x, exp, mod, false);
+}
+//the same for gcd(m, base) == 1 (odd m in BigInteger<0>), Nan for other m: the sequence of limb operations
+//depends on the sizes of x, m and on the bit length of exp beyond that of m, not on the bits of exp
+template<unsigned long long BASE>
+BigInteger<BASE> powmodConstTime(const BigInteger<BASE>& x, const BigInteger<BASE>& exp, const BigInteger<BASE>& mod) {
+	return BigInteger<BASE>::powModular(x, exp, mod, true);
+}
+template<unsigned long long BASE, typename Y>
+BigInteger<BASE> powmod(const BigInteger<BASE>& x, const Y& exp, const BigInteger<BASE>& mod) {return powmod(x, BigInteger<BASE>(exp), mod);}
+template<unsigned long long BASE, typename Y>
+BigInteger<BASE> powmodConstTime(const BigInteger<BASE>& x, const Y& exp, const BigInteger<BASE>& mod) {return powmodConstTime(x, BigInteger<BASE>(exp), mod);}
+
+//modulus context: the Barrett reciprocal and the Montgomery constants are found once
+//results go to r, which keeps its limbs between calls; scratch is kept inside, so a Modulus serves one thread
+template<unsigned long long BASE>
+class Modulus {
+	public:
+		typedef BigInteger<BASE> integer;
+		typedef typename integer::typev typev;
+		typedef typename integer::kernel kernel;
+		typedef typename integer::karatsuba karatsuba;
+		typedef typename integer::buffer buffer;
+		typedef BIS::Montgomery<typev, integer::LIMB> montgomery;
+
+		explicit Modulus(const integer& m);//|m|, Nan results if m is 0 or not real
+		const integer& value() const {return _m;}
+		bool isMontgomery() const {return _montgomery;}//gcd(m, base) == 1
+		//x of up to 2n limbs goes through Barrett, a longer x through divide()
+		integer& reduce(integer& r, const integer& x) const;//r = x mod m in [0, m)
+		//a, b in [0, m) are not copied, other values are reduced first
+		integer& mulmod(integer& r, const integer& a, const integer& b) const;
+		integer& addmod(integer& r, const integer& a, const integer& b) const;
+		integer& submod(integer& r, const integer& a, const integer& b) const;
+		//Montgomery form x*R mod m, R = base^n; Nan unless isMontgomery()
+		integer& toMontgomery(integer& r, const integer& x) const;
+		integer& fromMontgomery(integer& r, const integer& x) const;
+		integer& mulMontgomery(integer& r, const integer& a, const integer& b) const;//r = a*b/R mod m, a, b in [0, m)
+	private:
+		bool isValid() const {return _m.isReal() && !_m.isNull();}
+		bool canonical(const integer& x) const {return x.isReal() && (x.sign() || x.isNull()) && x.smallerAbs(_m);}
+		typev* prepare(integer& r) const;//r gets n+1+EXTRA limbs
+		void finish(integer& r, int size) const;//limbs of r from size up are cleared
+		void reduceSpan(typev* r, const typev* x, int xn) const;//r = x mod m, r has n+1+EXTRA limbs, xn <= 2n
+		void mulSpan(typev* r, const typev* a, int an, const typev* b, int bn, typev* w) const;//r = a*b, r has an+bn limbs
+		const typev* padded(const integer& x, typev* p) const;//x as n limbs
+		enum {
+			EXTRA = (integer::LIMB != 0 && integer::LIMB < 4) ? 1 : 0/*x - q*m < 4m needs base^(n+2)*/,
+			TRUNCATE = (integer::LIMB == 0 || integer::LIMB > 65536) ? 1 : 0/*n < base^2*/
+		};
+
+		integer _m;
+		integer _mu;//base^(2n)/m
+		integer _r2;//R^2 mod m
+		int _n;
+		bool _montgomery;
+		typev _minv;//-1/m mod base
+		int _threshold;
+		mutable buffer _t;
+};
+
+template<unsigned long long BASE>
+Modulus<BASE>::Modulus(const integer& m) : _m(m), _n(1), _montgomery(false), _minv(0), _threshold(BIS::Threshold<typev>::karatsuba) {
+	if(!isValid()) 
+		return;
+	_m.abs();
+	_n = _m.realSize();
+	_mu = (integer(1) <<= 2*_n) / _m;
+	_montgomery = montgomery::invertible(_m._a[0]);
+	if(_montgomery) {
+		_minv = montgomery::inverse(_m._a[0]);
+		_r2 = integer::residue(integer(1) <<= 2*_n, _m);
+	}
+	int n = _n;
+	//x, q1*mu, q3*m, Karatsuba: the blocks of unbalanced products follow Euclid's remainders, 8(n+1) covers them
+	int size = 5*n+6 + 8*(n+1) + karatsuba::scratch(n+1, _threshold);
+	int msize = 2*n + montgomery::scratch(n, _threshold);//a, b, Montgomery
+	_t.resize((size > msize) ? size : msize);
+}
+template<unsigned long long BASE>
+typename Modulus<BASE>::typev* Modulus<BASE>::prepare(integer& r) const {
+	int old = r.isReal() ? r.realSize() : 1;
+	r.reserve(_n+1+EXTRA);
+	for(int index = _n+1+EXTRA; index < old; ++index) 
+		r._a[index] = 0;
+	r._state = integer::REAL;
+	r._sign = true;
+	return &r._a[0];
+}
+template<unsigned long long BASE>
+void Modulus<BASE>::finish(integer& r, int size) const {
+	for(int index = size; index < _n+1+EXTRA; ++index) 
+		r._a[index] = 0;
+	r.updRealSize();
+}
+template<unsigned long long BASE>
+void Modulus<BASE>::mulSpan(typev* r, const typev* a, int an, const typev* b, int bn, typev* w) const {
+	if(an < bn) {
+		std::swap(a, b);
+		std::swap(an, bn);
+	}
+	karatsuba::mul(r, a, an, b, bn, w, _threshold);
+}
+//Barrett: q = ((x/base^(n-1))*mu)/base^(n+1) is at most 2 less than x/m (3 with the low columns of the product skipped),
+//r = x - q*m mod base^(n+1), one limb more for the bases 2 and 3; so m is subtracted at most 3 times
+template<unsigned long long BASE>
+void Modulus<BASE>::reduceSpan(typev* r, const typev* x, int xn) const {
+	int n = _n;
+	int length = n+1+EXTRA;
+	const typev* m = &_m._a[0];
+	if(xn < n || (xn == n && kernel::compare(x, m, n) < 0)) {
+		for(int index = 0; index < length; ++index) 
+			r[index] = (index < xn) ? x[index] : 0;
+		return;
+	}
+	typev* q = &_t[2*n+2];
+	typev* p = &_t[4*n+4];
+	int qn = xn - (n-1);
+	int mun = _mu.realSize();
+	const typev* mu = &_mu._a[0];
+	if(TRUNCATE) {//columns below n-1 add less than n/base^2 to q
+		for(int index = 0; index < qn+mun; ++index) 
+			q[index] = 0;
+		for(int index = 0; index < qn; ++index) {
+			int low = (n-1-index > 0) ? n-1-index : 0;
+			if(low < mun) 
+				q[index+mun] = kernel::addMulLimb(q+index+low, mu+low, mun-low, x[n-1+index]);
+		}
+	}
+	else 
+		mulSpan(q, x + (n-1), qn, mu, mun, &_t[5*n+6]);
+	int q3 = qn + mun - (n+1);
+	while(q3 > 0 && q[n+1+q3-1] == 0) 
+		--q3;
+	for(int index = 0; index < length; ++index) 
+		r[index] = (index < xn) ? x[index] : 0;
+	if(q3 > 0) {//only the low limbs of q3*m are needed
+		for(int index = 0; index < length; ++index) 
+			p[index] = 0;
+		for(int index = 0; index < q3 && index < length; ++index) {
+			int count = (n < length-index) ? n : length-index;
+			typev carry = kernel::addMulLimb(p+index, m, count, q[n+1+index]);
+			if(index+count < length) 
+				p[index+count] = carry;
+		}
+		kernel::sub(r, r, length, p, length);//mod base^length
+	}
+	for(int count = 0; count < 3 && (r[n] != 0 || r[length-1] != 0 || kernel::compare(r, m, n) >= 0); ++count) 
+		kernel::sub(r, r, length, m, n);
+}
+template<unsigned long long BASE>
+const typename Modulus<BASE>::typev* Modulus<BASE>::padded(const integer& x, typev* p) const {
+	int size = x.realSize();
+	for(int index = 0; index < _n; ++index) 
+		p[index] = (index < size) ? x._a[index] : 0;
+	return p;
+}
+
+template<unsigned long long BASE>
+BigInteger<BASE>& Modulus<BASE>::reduce(integer& r, const integer& x) const {
+	if(!isValid() || !x.isReal()) {
+		r.setNan();
+		return r;
+	}
+	if(x.realSize() > 2*_n) 
+		return r = integer::residue(x, _m);
+	bool negative = !x.sign();
+	reduceSpan(&_t[0], &x._a[0], x.realSize());//x may be r
+	bool zero = true;
+	for(int index = 0; index < _n; ++index) 
+		zero = zero && _t[index] == 0;
+	if(negative && !zero) 
+		kernel::sub(&_t[0], &_m._a[0], _n, &_t[0], _n);
+	typev* pr = prepare(r);
+	for(int index = 0; index < _n; ++index) 
+		pr[index] = _t[index];
+	finish(r, _n);
+	return r;
+}
+template<unsigned long long BASE>
+BigInteger<BASE>& Modulus<BASE>::mulmod(integer& r, const integer& a, const integer& b) const {
+	if(!isValid() || !a.isReal() || !b.isReal()) {
+		r.setNan();
+		return r;
+	}
+	if(!canonical(a) || !canonical(b)) {
+		integer x, y;
+		reduce(x, a);
+		reduce(y, b);
+		return mulmod(r, x, y);
+	}
+	int an = a.realSize();
+	int bn = b.realSize();
+	typev* pr = prepare(r);
+	mulSpan(&_t[0], &a._a[0], an, &b._a[0], bn, &_t[5*_n+6]);
+	reduceSpan(pr, &_t[0], an+bn);
+	finish(r, _n+1+EXTRA);
+	return r;
+}
+template<unsigned long long BASE>
+BigInteger<BASE>& Modulus<BASE>::addmod(integer& r, const integer& a, const integer& b) const {
+	if(!isValid() || !a.isReal() || !b.isReal()) {
+		r.setNan();
+		return r;
+	}
+	if(!canonical(a) || !canonical(b)) {
+		integer x, y;
+		reduce(x, a);
+		reduce(y, b);
+		return addmod(r, x, y);
+	}
+	int n = _n;
+	typev* pr = prepare(r);
+	typev* s = &_t[0];
+	s[n] = kernel::add(s, padded(a, s), n, padded(b, s+n+1), n);
+	if(s[n] != 0 || kernel::compare(s, &_m._a[0], n) >= 0) 
+		kernel::sub(s, s, n+1, &_m._a[0], n);
+	for(int index = 0; index < n; ++index) 
+		pr[index] = s[index];
+	finish(r, n);
+	return r;
+}
+template<unsigned long long BASE>
+BigInteger<BASE>& Modulus<BASE>::submod(integer& r, const integer& a, const integer& b) const {
+	if(!isValid() || !a.isReal() || !b.isReal()) {
+		r.setNan();
+		return r;
+	}
+	if(!canonical(a) || !canonical(b)) {
+		integer x, y;
+		reduce(x, a);
+		reduce(y, b);
+		return submod(r, x, y);
+	}
+	int n = _n;
+	typev* pr = prepare(r);
+	typev* s = &_t[0];
+	if(kernel::sub(s, padded(a, s), n, padded(b, s+n+1), n) != 0) 
+		kernel::add(s, s, n, &_m._a[0], n);//the carry cancels the borrow
+	for(int index = 0; index < n; ++index) 
+		pr[index] = s[index];
+	finish(r, n);
+	return r;
+}
+template<unsigned long long BASE>
+BigInteger<BASE>& Modulus<BASE>::mulMontgomery(integer& r, const integer& a, const integer& b) const {
+	if(!isValid() || !_montgomery || !canonical(a) || !canonical(b)) {
+		r.setNan();
+		return r;
+	}
+	int n = _n;
+	typev* pr = prepare(r);
+	montgomery::mul(pr, padded(a, &_t[0]), padded(b, &_t[n]), &_m._a[0], n, _minv, &_t[2*n], _threshold);
+	finish(r, n);
+	return r;
+}
+template<unsigned long long BASE>
+BigInteger<BASE>& Modulus<BASE>::toMontgomery(integer& r, const integer& x) const {
+	if(!isValid() || !_montgomery || !x.isReal()) {
+		r.setNan();
+		return r;
+	}
+	reduce(r, x);
+	return mulMontgomery(r, r, _r2);
+}
+template<unsigned long long BASE>
+BigInteger<BASE>& Modulus<BASE>::fromMontgomery(integer& r, const integer& x) const {
+	if(!isValid() || !_montgomery || !canonical(x)) {
+		r.setNan();
+		return r;
+	}
+	int n = _n;
+	typev* t = &_t[0];
+	padded(x, t);
+	for(int index = n; index <= 2*n; ++index) 
+		t[index] = 0;
+	typev* pr = prepare(r);
+	montgomery::redc(pr, t, &_m._a[0], n, _minv);
+	finish(r, n);
+	return r;
+}
+
+#endif
@@ -0,0 +1,171 @@
+/*
+Copyright (C) 2014 Ilya Arkhipovsky
+This file is part of BigInteger.
+( Implementation of long arithmetic. The base of the system of numeration is any integer from 2 to 1 << ((sizeof(unsigned long long)<<2)-1) )
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Contact e-mail <arkhipovsky.ilya@yandex.ru>
+*/
+
+#ifndef BIG_INTEGER_NTT_HPP
+#define BIG_INTEGER_NTT_HPP
+
+namespace BigIntegerSpace {
+	//number theoretic transform modulo the prime P = c*2^k + 1, G is a primitive root
+	//values are < P < 1 << 31, so a sum of two fits in unsigned int
+	//the butterflies of a level, the pointwise products and the Garner steps are split into blocks of GRAIN for BIS::ThreadPool
+	template<unsigned P, unsigned G>
+	struct Ntt {
+		enum {
+			GRAIN = 1<<14/*butterflies or values per task*/
+		};
+
+		static unsigned mul(unsigned a, unsigned b) {return static_cast<unsigned>(static_cast<unsigned long long>(a)*b % P);}
+		static unsigned pow(unsigned a, unsigned e) {
+			unsigned res = 1;
+			for(; e; e >>= 1) {
+				if(e & 1) res = mul(res, a);
+				a = mul(a, a);
+			}
+			return res;
+		}
+		static void transform(unsigned* a, int n, bool inverse) {//n is a power of two dividing P-1
+			for(int index = 1, j = 0; index < n; ++index) {//bit reversal
+				int bit = n >> 1;
+				for(; j & bit; bit >>= 1) 
+					j ^= bit;
+				j ^= bit;
+				if(index < j) std::swap(a[index], a[j]);
+			}
+			vector<unsigned> roots((n >> 1) + 1);
+			unsigned w = pow(G, (P-1)/n);
+			if(inverse) w = pow(w, P-2);
+			roots[0] = 1;
+			for(int index = 1; index < (n >> 1); ++index) 
+				roots[index] = mul(roots[index-1], w);
+			for(int len = 2; len <= n; len <<= 1) {
+				int half = len >> 1;
+				int step = n/len;
+				const unsigned* r = &roots[0];
+				if(half < GRAIN) //tasks take whole blocks
+					ThreadPool::forRange(0, n/len, GRAIN/half, [&](int from, int to) {
+						for(int block = from; block < to; ++block) 
+							butterflies(a + block*len, half, r, step, 0, half);
+					});
+				else //tasks split the blocks
+					for(int begin = 0; begin < n; begin += len) 
+						ThreadPool::forRange(0, half, GRAIN, [&](int from, int to) {butterflies(a + begin, half, r, step, from, to);});
+			}
+			if(inverse) {
+				unsigned ninv = pow(static_cast<unsigned>(n), P-2);
+				ThreadPool::forRange(0, n, GRAIN, [&](int from, int to) {
+					for(int index = from; index < to; ++index) 
+						a[index] = mul(a[index], ninv);
+				});
+			}
+		}
+		static void butterflies(unsigned* lo, int half, const unsigned* roots, int step, int from, int to) {//j in [from, to) of a block
+			unsigned* hi = lo + half;
+			for(int j = from; j < to; ++j) {
+				unsigned u = lo[j];
+				unsigned v = mul(hi[j], roots[j*step]);
+				lo[j] = (u + v >= P) ? u + v - P : u + v;
+				hi[j] = (u >= v) ? u - v : u + P - v;
+			}
+		}
+		//fa = fa*fb cyclic of length n, fb is destroyed, fb == fa squares
+		static void convolve(unsigned* fa, unsigned* fb, int n) {
+			transform(fa, n, false);
+			if(fb != fa) 
+				transform(fb, n, false);
+			ThreadPool::forRange(0, n, GRAIN, [&](int from, int to) {
+				for(int index = from; index < to; ++index) 
+					fa[index] = mul(fa[index], fb[index]);
+			});
+			transform(fa, n, true);
+		}
+	};
+
+	//exact convolution of digit arrays, digits < 1 << 32
+	//three primes with 2^26 | P-1, their product exceeds 2^90 > (1 << 25)*(1 << 32)^2
+	struct Convolution {
+		typedef Ntt<469762049U, 3> ntt1;
+		typedef Ntt<1811939329U, 13> ntt2;
+		typedef Ntt<2013265921U, 31> ntt3;
+		enum {
+			maxLength = 1<<26/*an + bn - 1 <= maxLength*/
+		};
+
+		//r[3*k] + r[3*k+1]*2^32 + r[3*k+2]*2^64 = sum a[i]*b[k-i], k < an+bn-1
+		//b == a squares
+		static void mul(vector<unsigned>& r, const unsigned* a, int an, const unsigned* b, int bn) {
+			const unsigned p1 = 469762049U, p2 = 1811939329U, p3 = 2013265921U;
+			int size = an + bn - 1;
+			int n = 1;
+			while(n < size) 
+				n <<= 1;
+
+			//the primes are independent: one buffer of b each while the pool runs them at once
+			bool together = ThreadPool::active();
+			vector<unsigned> f1(n), f2(n), f3(n), g((b == a) ? 0 : (together ? 3 : 1)*n);
+			ThreadPool::forEach(3, [&](int prime) {
+				unsigned* f = (prime == 0) ? &f1[0] : (prime == 1) ? &f2[0] : &f3[0];
+				unsigned* fb = f;
+				unsigned p = (prime == 0) ? p1 : (prime == 1) ? p2 : p3;
+				load(f, n, a, an, p);
+				if(b != a) {
+					fb = &g[0] + (together ? prime*n : 0);
+					load(fb, n, b, bn, p);
+				}
+				if(prime == 0) 
+					ntt1::convolve(f, fb, n);
+				else if(prime == 1) 
+					ntt2::convolve(f, fb, n);
+				else 
+					ntt3::convolve(f, fb, n);
+			});
+
+			//Garner: x = r1 + p1*t2 + p1*p2*t3
+			const unsigned inv1 = ntt2::pow(p1, p2-2);//1/p1 mod p2
+			const unsigned long long p12 = static_cast<unsigned long long>(p1)*p2;
+			const unsigned inv12 = ntt3::pow(static_cast<unsigned>(p12 % p3), p3-2);//1/(p1*p2) mod p3
+			const unsigned long long mask = 0xffffffffULL;
+			r.resize(3*size);
+			ThreadPool::forRange(0, size, ntt1::GRAIN, [&](int from, int to) {
+				for(int k = from; k < to; ++k) {
+					unsigned x1 = f1[k];
+					unsigned t2 = ntt2::mul((f2[k] >= x1) ? f2[k] - x1 : f2[k] + p2 - x1, inv1);
+					unsigned long long low = x1 + static_cast<unsigned long long>(p1)*t2;
+					unsigned lowp3 = static_cast<unsigned>(low % p3);
+					unsigned t3 = ntt3::mul((f3[k] >= lowp3) ? f3[k] - lowp3 : f3[k] + p3 - lowp3, inv12);
+					unsigned long long s = (p12 & mask)*t3 + (low & mask);
+					r[3*k] = static_cast<unsigned>(s);
+					s = (p12 >> 32)*t3 + (low >> 32) + (s >> 32);
+					r[3*k+1] = static_cast<unsigned>(s);
+					r[3*k+2] = static_cast<unsigned>(s >> 32);
+				}
+			});
+		}
+	private:
+		static void load(unsigned* f, int n, const unsigned* a, int an, unsigned p) {//f = a mod p padded with 0 to n
+			for(int index = 0; index < an; ++index)
+				f[index] = a[index] % p;
+			for(int index = an; index < n; ++index)
+				f[index] = 0;
+		}
+	};
+}
+
+#endif
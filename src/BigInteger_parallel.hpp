@@ -0,0 +1,233 @@
+/*
+Copyright (C) 2014 Ilya Arkhipovsky
+This file is part of BigInteger.
+( Implementation of long arithmetic. The base of the system of numeration is any integer from 2 to 1 << ((sizeof(unsigned long long)<<2)-1) )
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Contact e-mail <arkhipovsky.ilya@yandex.ru>
+*/
+
+#ifndef BIG_INTEGER_PARALLEL_HPP
+#define BIG_INTEGER_PARALLEL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace BigIntegerSpace {
+	//work-stealing pool for the subproducts of operator*, square() and the NTT, off until threads(count) is set above 1
+	//every thread owns a deque: it takes its newest task and steals the oldest task of another deque;
+	//a thread waiting for its tasks runs queued ones meanwhile, so nested forks never deadlock
+	//BIS::ThreadPool::threads(8); products above BIS::Threshold<typev>::parallel limbs are forked
+	class ThreadPool {
+	public:
+		static void threads(int count) {//the calling thread counts, 0 or 1 stops the workers; not while products run
+			ThreadPool& pool = instance();
+			pool.stop();
+			if(count > 1) 
+				pool.start(count-1);
+		}
+		static int threads() {return instance()._count + 1;}
+		static bool active() {return instance()._active.load(std::memory_order_relaxed);}
+
+		template<typename F>
+		static void forEach(int count, const F& f) {//f(0), .., f(count-1), in parallel while the pool is active
+			if(count < 2 || !active()) {
+				for(int index = 0; index < count; ++index) 
+					f(index);
+				return;
+			}
+			instance().run(count, f);
+		}
+		template<typename F>
+		static void forRange(int begin, int end, int grain, const F& f) {//f(from, to) over blocks of grain
+			forEach((end - begin + grain - 1)/grain, [&](int index) {
+				int from = begin + index*grain;
+				f(from, (end - from < grain) ? end : from + grain);
+			});
+		}
+	private:
+		struct Task {
+			void (*call)(const void*, int);
+			const void* f;
+			int index;
+			std::atomic<bool> done;
+		};
+		struct Queue {
+			std::mutex lock;
+			std::deque<Task*> tasks;
+		};
+
+		ThreadPool() : _count(0), _pending(0), _stopping(false), _active(false) {}
+		~ThreadPool() {stop();}
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		static ThreadPool& instance() {
+			static ThreadPool pool;
+			return pool;
+		}
+		static int& self() {//queue of this thread, -1 outside of the workers
+			static thread_local int index = -1;
+			return index;
+		}
+		template<typename F>
+		static void call(const void* f, int index) {(*static_cast<const F*>(f))(index);}
+
+		void start(int count) {
+			_count = count;
+			_stopping = false;
+			for(int index = 0; index <= count; ++index) //the last queue is shared by the other threads
+				_queues.push_back(std::unique_ptr<Queue>(new Queue));
+			for(int index = 0; index < count; ++index) 
+				_workers.push_back(std::thread(&ThreadPool::work, this, index));
+			_active = true;
+		}
+		void stop() {
+			_active = false;
+			{
+				std::lock_guard<std::mutex> guard(_sleep);
+				_stopping = true;
+			}
+			_wake.notify_all();
+			for(size_t index = 0; index < _workers.size(); ++index) 
+				_workers[index].join();
+			_workers.clear();
+			_queues.clear();
+			_count = 0;
+		}
+		template<typename F>
+		void run(int count, const F& f) {//tasks 1..count-1 are queued, f(0) runs here
+			std::unique_ptr<Task[]> tasks(new Task[count-1]);
+			Queue& queue = *_queues[(self() < 0) ? _count : self()];
+			for(int index = 1; index < count; ++index) {
+				Task& task = tasks[index-1];
+				task.call = &call<F>;
+				task.f = &f;
+				task.index = index;
+				task.done = false;
+				std::lock_guard<std::mutex> guard(queue.lock);
+				queue.tasks.push_back(&task);
+			}
+			_pending += count-1;
+			{
+				std::lock_guard<std::mutex> guard(_sleep);
+			}
+			_wake.notify_all();
+			f(0);
+			for(int index = count-2; index >= 0; --index) 
+				wait(tasks[index]);
+		}
+		Task* take() {//the newest task of this thread, else the oldest of another one
+			int size = _count + 1;
+			int own = (self() < 0) ? _count : self();
+			for(int k = 0; k < size; ++k) {
+				Queue& queue = *_queues[(own + k) % size];
+				std::lock_guard<std::mutex> guard(queue.lock);
+				if(queue.tasks.empty()) 
+					continue;
+				Task* task;
+				if(k == 0) {
+					task = queue.tasks.back();
+					queue.tasks.pop_back();
+				}
+				else {
+					task = queue.tasks.front();
+					queue.tasks.pop_front();
+				}
+				--_pending;
+				return task;
+			}
+			return 0;
+		}
+		static void execute(Task* task) {
+			task->call(task->f, task->index);
+			task->done.store(true, std::memory_order_release);
+		}
+		void wait(Task& task) {
+			while(!task.done.load(std::memory_order_acquire)) {
+				Task* other = take();
+				if(other) 
+					execute(other);
+				else 
+					std::this_thread::yield();
+			}
+		}
+		void work(int index) {
+			self() = index;
+			for(;;) {
+				Task* task = take();
+				if(task) {
+					execute(task);
+					continue;
+				}
+				std::unique_lock<std::mutex> guard(_sleep);
+				_wake.wait(guard, [this] {return _stopping || _pending.load() > 0;});
+				if(_stopping) 
+					return;
+			}
+		}
+
+		vector< std::unique_ptr<Queue> > _queues;
+		vector<std::thread> _workers;
+		int _count;//workers
+		std::atomic<int> _pending;//queued tasks
+		std::mutex _sleep;
+		std::condition_variable _wake;
+		bool _stopping;
+		std::atomic<bool> _active;
+	};
+
+	//x^(2^j) shared by all threads: the table only grows and its deque keeps the values in place,
+	//callers get pointers to them; squares are found outside of the lock
+	template<typename T>
+	class PowerTable {
+	public:
+		vector<const T*> powers(const T& x, int levels, int limbs) {//until j >= levels and the last one has more than limbs/2 limbs
+			for(;;) {
+				const T* last;
+				size_t size;
+				{
+					std::lock_guard<std::mutex> guard(_lock);
+					if(_powers.empty()) {
+						_powers.push_back(x);
+						_powers.back().realSize();//realSize is lazy, readers must not write it
+					}
+					size = _powers.size();
+					last = &_powers.back();
+					if(static_cast<int>(size) >= levels && 2*last->realSize() > limbs) {
+						vector<const T*> res(size);
+						for(size_t index = 0; index < size; ++index) 
+							res[index] = &_powers[index];
+						return res;
+					}
+				}
+				T next = square(*last);
+				next.realSize();
+				std::lock_guard<std::mutex> guard(_lock);
+				if(_powers.size() == size) 
+					_powers.push_back(std::move(next));
+			}
+		}
+	private:
+		std::deque<T> _powers;
+		std::mutex _lock;
+	};
+}
+
+#endif
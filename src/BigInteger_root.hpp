@@ -0,0 +1,124 @@
+/*
+Copyright (C) 2014 Ilya Arkhipovsky
+This file is part of BigInteger.
+( Implementation of long arithmetic. The base of the system of numeration is any integer from 2 to 1 << ((sizeof(unsigned long long)<<2)-1) )
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Contact e-mail <arkhipovsky.ilya@yandex.ru>
+*/
+
+#ifndef BIG_INTEGER_ROOT_HPP
+#define BIG_INTEGER_ROOT_HPP
+
+//roots
+template<unsigned long long BASE>
+BigInteger<BASE> BigInteger<BASE>::power(const BigInteger<BASE>& x, int k) {//x^k, k >= 0
+	BigInteger res = 1;
+	for(int bit = BIS::bitLength(k) - 1; bit >= 0; --bit) {
+		res = square(res);
+		if((k >> bit) & 1) 
+			res *= x;
+	}
+	return res;
+}
+//n^(1/k) from the leading limbs in long double, rounded up: the error of log2 is far below the margin
+template<unsigned long long BASE>
+BigInteger<BASE> BigInteger<BASE>::rootEstimate(const BigInteger<BASE>& n, int k) {
+	const long double base = (LIMB == 0) ? std::ldexp(1.0L, 8*sizeof(typev)) : static_cast<long double>(LIMB);
+	int index = n.realSize()-1;
+	long double top = 0;
+	for(; index >= 0 && top < 1e20L; --index) 
+		top = top*base + static_cast<long double>(n._a[index]);
+	//n < (top + 1)*base^(index+1)
+	long double lg = (std::log2(top + 1) + (index+1)*std::log2(base)) / k + 1e-9L;
+	int shift = (lg < 62) ? 0 : static_cast<int>(lg) - 61;
+	BigInteger res = static_cast<unsigned long long>(std::exp2(lg - shift)) + 1;
+	return std::move(res.shiftBits(shift));
+}
+//precision doubling: the root of the top half of the limbs is exact, one Newton step from above
+//then leaves an error of a few units, the last steps are checked by r^k <= n
+template<unsigned long long BASE>
+BigInteger<BASE> BigInteger<BASE>::rootCore(const BigInteger<BASE>& n, int k) {//floor(n^(1/k)), n > 0, k >= 2
+	int h = (n.realSize()-1) / (2*k);
+	BigInteger r;
+	if(h == 0) 
+		r = rootEstimate(n, k);
+	else {
+		r = rootCore(n >> (k*h), k);
+		r += 1;
+		r <<= h;//>= n^(1/k)
+	}
+	for(;;) {//every step keeps r >= floor(n^(1/k)) and decreases r while r^k > n
+		BigInteger p = power(r, k-1);
+		if(((k == 2) ? square(r) : p*r) <= n) 
+			return r;
+		BigInteger y = n / p;
+		y += r*(k-1);
+		y /= k;
+		if(y < r) 
+			r = std::move(y);
+		else 
+			r -= 1;
+	}
+}
+
+template<unsigned long long BASE>
+BigInteger<BASE> isqrt(const BigInteger<BASE>& x) {//floor(sqrt(x)), Nan if x < 0
+	return iroot(x, 2);
+}
+template<unsigned long long BASE>
+BigInteger<BASE> iroot(const BigInteger<BASE>& x, int k) {//x^(1/k) rounded to zero, Nan if k < 1 or x < 0 with an even k
+	if(!x.isReal() || k < 1 || (!x.sign() && !x.isNull() && k % 2 == 0)) {
+		BigInteger<BASE> res;
+		res.setNan();
+		return res;
+	}
+	if(x.isNull()) 
+		return BigInteger<BASE>(0);
+	if(k == 1) 
+		return x;
+	BigInteger<BASE> a(x);
+	a.abs();
+	BigInteger<BASE> res = BigInteger<BASE>::rootCore(a, k);
+	if(!x.sign()) 
+		res.invertSign();
+	return res;
+}
+//squares are filtered by their residues modulo 64, 63, 65 and 11 before the root is taken
+template<unsigned long long BASE>
+bool isPerfectSquare(const BigInteger<BASE>& x) {
+	if(!x.isReal()) 
+		return false;
+	if(x.isNull()) 
+		return true;
+	if(!x.sign()) 
+		return false;
+	const unsigned long long mods[] = {64, 63, 65, 11};
+	BigInteger<BASE> rest = BigInteger<BASE>::residue(x, BigInteger<BASE>(64ULL*63*65*11));
+	unsigned long long value = 0;
+	for(int index = rest.realSize()-1; index >= 0; --index) 
+		value = (BigInteger<BASE>::LIMB == 0) ? static_cast<unsigned long long>(rest.index(index)) : value*BigInteger<BASE>::LIMB + rest.index(index);
+	for(int j = 0; j < 4; ++j) {
+		unsigned long long r = value % mods[j], i = 0;
+		while(i <= mods[j]/2 && i*i % mods[j] != r) 
+			++i;
+		if(i > mods[j]/2) 
+			return false;
+	}
+	BigInteger<BASE> root = BigInteger<BASE>::rootCore(x, 2);
+	return square(root) == x;
+}
+
+#endif
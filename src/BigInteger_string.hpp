@@ -0,0 +1,273 @@
+/*
+Copyright (C) 2014 Ilya Arkhipovsky
+This file is part of BigInteger.
+( Implementation of long arithmetic. The base of the system of numeration is any integer from 2 to 1 << ((sizeof(unsigned long long)<<2)-1) )
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Contact e-mail <arkhipovsky.ilya@yandex.ru>
+*/
+
+#ifndef BIG_INTEGER_STRING_HPP
+#define BIG_INTEGER_STRING_HPP
+
+namespace BigIntegerSpace {
+	//radix^digits, the largest power of radix in a native limb
+	struct RadixChunk {
+		typedef BigInteger<0>::typev typev;
+
+		explicit RadixChunk(int r) : radix(r), digits(1), power(r) {
+			while(power <= static_cast<typev>(~static_cast<typev>(0)) / radix) {
+				power *= radix;
+				++digits;
+			}
+		}
+
+		int radix;
+		int digits;
+		typev power;
+	};
+
+	//power^(2^j) for every radix, grown until the last one has more than limbs/2 limbs and j < levels
+	inline vector<const BigInteger<0>*> radixPowers(const RadixChunk& chunk, int limbs, int levels = 0) {
+		static PowerTable< BigInteger<0> > cache[37];
+		return cache[chunk.radix].powers(BigInteger<0>(static_cast<unsigned long long>(chunk.power), true), levels, limbs);
+	}
+
+	//0-9, a-z, A-Z; 36 for any other char
+	inline int digitValue(char c) {
+		if(c >= '0' && c <= '9') return c - '0';
+		if(c >= 'a' && c <= 'z') return c - 'a' + 10;
+		if(c >= 'A' && c <= 'Z') return c - 'A' + 10;
+		return 36;
+	}
+
+	//value of the digits [first, last), chunks of digits are read into a word
+	//long strings are split by the powers of radix: hi*power^(2^j) + lo, lo has digits*2^j chars
+	inline BigInteger<0> readDigits(const char* first, const char* last, const RadixChunk& chunk) {
+		int chunks = static_cast<int>((last - first + chunk.digits - 1)/chunk.digits);
+		if(chunks <= 32) {
+			BigInteger<0> res;
+			BigInteger<0> power(static_cast<unsigned long long>(chunk.power), true);
+			const char* p = first;
+			int head = static_cast<int>((last - first) % chunk.digits);
+			if(head == 0) 
+				head = chunk.digits;
+			while(p < last) {
+				RadixChunk::typev word = 0;
+				for(const char* end = p + head; p < end; ++p) 
+					word = word*chunk.radix + digitValue(*p);
+				res = res*power;
+				res += BigInteger<0>(static_cast<unsigned long long>(word), true);
+				head = chunk.digits;
+			}
+			return res;
+		}
+		int level = 0;
+		while((2 << level) < chunks) 
+			++level;
+		vector<const BigInteger<0>*> powers = radixPowers(chunk, 0, level+1);
+		const char* middle = last - (chunk.digits << level);
+		BigInteger<0> res = readDigits(first, middle, chunk)*(*powers[level]);//recursion
+		res += readDigits(middle, last, chunk);//recursion
+		return res;
+	}
+
+	//digits of |u| are written backwards before end, at least width of them (leading 0)
+	//long numbers are split by the powers of radix: u = q*power^(2^j) + r, r takes digits*2^j places
+	inline char* writeDigits(const BigInteger<0>& u, char* end, int width, const RadixChunk& chunk) {
+		const char* symbols = "0123456789abcdefghijklmnopqrstuvwxyz";
+		char* p = end;
+		if(u.realSize() <= 32) {//one division by power per chunk of digits
+			BigInteger<0> v(u);
+			BigInteger<0>::divisor d(chunk.power);
+			while(!v.isNull()) {
+				BigInteger<0>::typev rest = v.divLimb(d);
+				for(int index = 0; index < chunk.digits && (rest != 0 || !v.isNull()); ++index) {//no leading 0 in the top chunk
+					*--p = symbols[rest % chunk.radix];
+					rest /= chunk.radix;
+				}
+			}
+		}
+		else {
+			vector<const BigInteger<0>*> powers = radixPowers(chunk, u.realSize());
+			int level = 0;
+			while(2*powers[level+1]->realSize() <= u.realSize()) 
+				++level;
+			std::pair< BigInteger<0>, BigInteger<0> > par = divide(u, *powers[level]);
+			int low = chunk.digits << level;
+			p = writeDigits(par.second, p, low, chunk);//recursion
+			p = writeDigits(par.first, p, width - low, chunk);//recursion
+		}
+		while(end - p < width) 
+			*--p = '0';
+		return p;
+	}
+}
+
+template<unsigned long long BASE>
+int BigInteger<BASE>::charsBound(int radix) const {
+	int lg = 0;//floor(log2(radix))
+	while((2 << lg) <= radix) 
+		++lg;
+	return realSize()*bitsize()/lg + 4;
+}
+template<unsigned long long BASE>
+std::string BigInteger<BASE>::toString(int radix) const {
+	if(radix < 2 || radix > 36) 
+		return std::string();
+	vector<char> buf(charsBound(radix));
+	char* end = toChars(&buf[0], &buf[0] + buf.size(), radix);
+	return std::string(&buf[0], end);
+}
+template<unsigned long long BASE>
+char* BigInteger<BASE>::toChars(char* first, char* last, int radix) const {
+	if(radix < 2 || radix > 36) 
+		return 0;
+	std::string special;
+	if(isNan()) special = "Nan";
+	else if(isInf()) special = sign() ? "Inf" : "-Inf";
+	if(!special.empty()) {
+		if(last - first < static_cast<int>(special.size())) 
+			return 0;
+		return std::copy(special.begin(), special.end(), first);
+	}
+
+	//digits are written backwards into the tail of the buffer, then moved to first
+	int bound = charsBound(radix);
+	vector<char> tmp;
+	char* end = last;
+	if(last - first < bound) {
+		tmp.resize(bound);
+		end = &tmp[0] + bound;
+	}
+	char* p = end;
+
+	int steps = 0;//LIMB = radix^steps, the limbs are split directly
+	unsigned long long power = 1;
+	if(LIMB != 0) {
+		while(power < LIMB && power <= ~0ULL/radix) {
+			power *= radix;
+			++steps;
+		}
+		if(power != LIMB) 
+			steps = 0;
+	}
+	if(steps) {
+		const char* symbols = "0123456789abcdefghijklmnopqrstuvwxyz";
+		for(int index = 0; index < realSize(); ++index) {
+			unsigned long long rest = _a[index];
+			for(int step = 0; step < steps; ++step) {
+				*--p = symbols[rest % radix];
+				rest /= radix;
+			}
+		}
+		while(p+1 < end && *p == '0') 
+			++p;
+	}
+	else {
+		BigInteger<0> u;
+		u.convert(*this);
+		if(!u.sign()) 
+			u = -u;
+		p = BIS::writeDigits(u, end, 1, BIS::RadixChunk(radix));
+	}
+	if(!sign()) 
+		*--p = '-';
+
+	if(last - first < end - p) 
+		return 0;
+	return std::copy(p, end, first);
+}
+template<unsigned long long BASE>
+const char* BigInteger<BASE>::fromChars(const char* first, const char* last, int radix) {
+	if(radix < 2 || radix > 36) 
+		return first;
+	const char* p = first;
+	bool sign = true;
+	if(p < last && (*p == '-' || *p == '+')) {
+		sign = (*p == '+');
+		++p;
+	}
+	if(last - p >= 3 && std::string(p, p+3) == "Inf") {
+		setInf();
+		_sign = sign;
+		return p+3;
+	}
+	if(last - p >= 3 && std::string(p, p+3) == "Nan") {
+		setNan();
+		return p+3;
+	}
+	const char* begin = p;
+	while(p < last && BIS::digitValue(*p) < radix) 
+		++p;
+	if(p == begin) 
+		return first;
+
+	int steps = 0;//LIMB = radix^steps, digits are grouped into limbs directly
+	unsigned long long power = 1;
+	if(LIMB != 0) {
+		while(power < LIMB && power <= ~0ULL/radix) {
+			power *= radix;
+			++steps;
+		}
+		if(power != LIMB) 
+			steps = 0;
+	}
+	if(steps) {
+		int count = static_cast<int>(p - begin);
+		int limbs = (count + steps - 1)/steps;
+		(*this) = 0;
+		reserve(limbs);
+		for(int index = 0; index < limbs; ++index) {
+			const char* end = p - index*steps;
+			const char* start = (end - begin > steps) ? end - steps : begin;
+			unsigned long long digit = 0;
+			for(; start < end; ++start) 
+				digit = digit*radix + BIS::digitValue(*start);
+			_a[index] = static_cast<typev>(digit);
+		}
+		updRealSize();
+	}
+	else 
+		convert(BIS::readDigits(begin, p, BIS::RadixChunk(radix)));
+	_sign = sign;
+	return p;
+}
+
+//input: [-+]digits in the radix of the stream (dec, hex, oct)
+template<unsigned long long BASE>
+std::istream& operator>>(std::istream& in, BigInteger<BASE>& big) {
+	std::istream::sentry guard(in);
+	if(!guard) 
+		return in;
+	int radix = (in.flags() & std::ios::hex) ? 16 : (in.flags() & std::ios::oct) ? 8 : 10;
+	std::string str;
+	int c = in.peek();
+	if(c == '-' || c == '+') {
+		str += static_cast<char>(in.get());
+		c = in.peek();
+	}
+	while(c != std::char_traits<char>::eof() && BIS::digitValue(static_cast<char>(c)) < radix) {
+		str += static_cast<char>(in.get());
+		c = in.peek();
+	}
+	const char* first = str.c_str();
+	const char* last = first + str.size();
+	if(big.fromChars(first, last, radix) != last || str.empty()) 
+		in.setstate(std::ios::failbit);
+	return in;
+}
+
+#endif
@@ -26,11 +26,6 @@ Contact e-mail <arkhipovsky.ilya@yandex.ru>
 using std::cout;
 using std::endl;
 
-BigInteger<10> factorial(const BigInteger<10>& value) {
-	if(value <= 1) return value;
-	return factorial(value - 1)*value;
-}
-
 int main() {
 	srand(time(NULL));
 	BigInteger<10> A,B,C;
@@ -38,7 +33,7 @@ int main() {
 	BigInteger<16> F;
 	BigInteger<2> E;
 
-	cout<<"\n-2*factorial(120)/factorial(119) = "<<(-2*factorial(120)/factorial(119))<<endl;//120
+	cout<<"\n-2*factorial(120)/factorial(119) = "<<(-2*factorial<10>(120)/factorial<10>(119))<<endl;//120
 	
 	A = -rand();
 	B = 0;